@@ -0,0 +1,118 @@
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <string>
+#include "core/headless/BatchRunner.h"
+#include "core/profiling/AllocationTracker.h"
+
+// simulates a batch of headless worlds in parallel and prints one json line per world and a summary line
+int main(int argc, char *argv[]) {
+    BatchConfig config;
+    // fails the run when a steady state tick allocates more than this
+    std::optional<unsigned long long> max_tick_allocations;
+    bool print_census = false;
+    // written as csv if the path ends with .csv, json otherwise
+    std::string report_path;
+    for (int i = 1; i < argc; i++) {
+        auto next_value = [&i, argc, argv]() { return static_cast<unsigned int>(std::stoul(argv[++i])); };
+
+        if (std::strcmp(argv[i], "--worlds") == 0 && i + 1 < argc) {
+            config.worlds = next_value();
+        } else if (std::strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) {
+            config.ticks = next_value();
+        } else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            config.threads = next_value();
+        } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            config.seed = next_value();
+        } else if (std::strcmp(argv[i], "--warmup") == 0 && i + 1 < argc) {
+            config.warmup_ticks = next_value();
+        } else if (std::strcmp(argv[i], "--max-tick-allocations") == 0 && i + 1 < argc) {
+            max_tick_allocations = next_value();
+        } else if (std::strcmp(argv[i], "--report") == 0 && i + 1 < argc) {
+            report_path = argv[++i];
+        } else if (std::strcmp(argv[i], "--autopilot") == 0) {
+            config.autopilot = true;
+        } else if (std::strcmp(argv[i], "--census") == 0) {
+            print_census = true;
+        } else if (std::strcmp(argv[i], "--stress") == 0 && i + 1 < argc) {
+            // n platforms of each type, n enemies and n bonuses
+            unsigned int n = next_value();
+            config.doodle_mode = false;
+            config.stress_config.platforms_per_type = n;
+            config.stress_config.enemies = n;
+            config.stress_config.bonuses = n;
+            config.stress_config.background = true;
+        } else {
+            std::cerr << "usage: " << argv[0] << " [--worlds n] [--ticks n] [--threads n] [--seed n] [--stress n] [--autopilot]"
+                      << " [--warmup n] [--max-tick-allocations n] [--census] [--report path]" << std::endl;
+            return 1;
+        }
+    }
+
+    if (max_tick_allocations && !allocation_tracker::isEnabled()) {
+        std::cerr << "allocation tracking is disabled, configure with -DGAMEENGINE_TRACK_ALLOCATIONS=ON" << std::endl;
+        return 1;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<BatchResult> results = BatchRunner(config).run();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    unsigned long long total_ticks = 0;
+    unsigned int failed_worlds = 0;
+    for (const BatchResult &result: results) {
+        total_ticks += result.ticks;
+        std::cout << R"({"world":)" << result.index << R"(,"seed":)" << result.seed << R"(,"ticks":)" << result.ticks
+                  << R"(,"score":)" << result.score << R"(,"physics_entities":)" << result.physics_entities
+                  << R"(,"gameover":)" << (result.gameover ? "true" : "false")
+                  << R"(,"max_tick_allocations":)" << result.max_tick_allocations
+                  << R"(,"max_tick_bytes":)" << result.max_tick_bytes << R"(,"elapsed":)" << result.elapsed
+                  << "}" << std::endl;
+
+        if (print_census) {
+            std::cout << R"({"world":)" << result.index << R"(,"census":[)";
+            bool first_entry = true;
+            for (const CensusEntry &entry: result.census.getEntries()) {
+                if (entry.count == 0 && entry.bytes == 0) continue;
+
+                std::cout << (first_entry ? "" : ",") << R"({"name":")" << entry.name << R"(","count":)"
+                          << entry.count << R"(,"bytes":)" << entry.bytes << "}";
+                first_entry = false;
+            }
+            std::cout << "]}" << std::endl;
+        }
+
+        if (max_tick_allocations && result.max_tick_allocations > *max_tick_allocations) {
+            failed_worlds++;
+        }
+    }
+
+    std::cout << R"({"worlds":)" << results.size() << R"(,"ticks":)" << total_ticks << R"(,"elapsed":)"
+              << elapsed.count() << R"(,"ticks_per_sec":)" << static_cast<double>(total_ticks) / elapsed.count()
+              << "}" << std::endl;
+
+    if (!report_path.empty()) {
+        std::ofstream report_file(report_path);
+        if (!report_file) {
+            std::cerr << "can't write the report to " << report_path << std::endl;
+            return 1;
+        }
+
+        RunReport report = BatchRunner::createReport(results, elapsed.count());
+        if (report_path.ends_with(".csv")) {
+            report.writeCsv(report_file);
+        } else {
+            report.writeJson(report_file);
+        }
+    }
+
+    if (failed_worlds > 0) {
+        std::cerr << failed_worlds << " worlds allocated more than " << *max_tick_allocations
+                  << " times in a steady state tick" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,94 @@
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <string>
+#include "core/profiling/RunReport.h"
+
+namespace {
+    std::optional<RunReport> readReport(const std::string &path) {
+        std::ifstream file(path);
+        if (!file) {
+            std::cerr << "can't open " << path << std::endl;
+            return std::nullopt;
+        }
+
+        std::optional<RunReport> report = RunReport::read(file);
+        if (!report) std::cerr << path << " isn't a run report" << std::endl;
+        return report;
+    }
+}
+
+// compares a run report of GameEngineBatch with a baseline report, exits with 1 if any metric regressed
+//
+// the default tolerances (see ReportTolerances) pass repeated runs of the same seed on a loaded machine, a release
+// check on a quiet machine with long runs (--ticks 20000 or more) can tighten the timings, e.g.
+//     GameEngineCompareReports baseline.json current.json --tolerance tick_ms.=0.2 --tolerance frame_ms.=0.2
+// and a check that only guards the allocations and entity counts can ignore the timings with
+//     --tolerance tick_ms.=1e9 --tolerance frame_ms.=1e9 --tolerance ticks_per_sec=1
+int main(int argc, char *argv[]) {
+    std::string baseline_path;
+    std::string current_path;
+    ReportTolerances tolerances;
+    bool verbose = false;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc) {
+            // either a default tolerance or prefix=tolerance
+            std::string tolerance = argv[++i];
+            std::size_t separator = tolerance.find('=');
+            if (separator == std::string::npos) {
+                tolerances.default_tolerance = std::stod(tolerance);
+            } else {
+                tolerances.overrides.emplace_back(tolerance.substr(0, separator),
+                                                  std::stod(tolerance.substr(separator + 1)));
+            }
+        } else if (std::strcmp(argv[i], "--verbose") == 0) {
+            verbose = true;
+        } else if (baseline_path.empty()) {
+            baseline_path = argv[i];
+        } else if (current_path.empty()) {
+            current_path = argv[i];
+        } else {
+            baseline_path.clear();
+            break;
+        }
+    }
+
+    if (baseline_path.empty() || current_path.empty()) {
+        std::cerr << "usage: " << argv[0] << " baseline current [--tolerance fraction] [--tolerance prefix=fraction]"
+                  << " [--verbose]" << std::endl;
+        return 1;
+    }
+
+    std::optional<RunReport> baseline = readReport(baseline_path);
+    std::optional<RunReport> current = readReport(current_path);
+    if (!baseline || !current) return 1;
+
+    unsigned int regressions = 0;
+    for (const MetricComparison &comparison: RunReport::compare(*baseline, *current, tolerances)) {
+        if (comparison.regressed) regressions++;
+        if (!comparison.regressed && !verbose) continue;
+
+        std::cout << (comparison.regressed ? "REGRESSED " : "ok        ") << std::left << std::setw(32)
+                  << comparison.name << std::right;
+        if (comparison.missing) {
+            std::cout << " missing from " << current_path << std::endl;
+            continue;
+        }
+
+        std::cout << " " << std::setw(14) << comparison.baseline << " -> " << std::setw(14) << comparison.current;
+        if (comparison.baseline != 0) {
+            std::cout << " (" << std::showpos << std::fixed << std::setprecision(1)
+                      << (comparison.current / comparison.baseline - 1) * 100 << "%" << std::noshowpos;
+            if (comparison.direction != MetricDirection::none) {
+                std::cout << ", tolerance " << comparison.tolerance * 100 << "%";
+            }
+            std::cout << ")" << std::defaultfloat << std::setprecision(6);
+        }
+        std::cout << std::endl;
+    }
+
+    std::cout << regressions << " of " << baseline->getMetrics().size() << " metrics regressed" << std::endl;
+    return regressions > 0 ? 1 : 0;
+}
@@ -0,0 +1,338 @@
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "core/World.h"
+#include "core/math/math_funcs.h"
+#include "core/headless/HeadlessViewCreator.h"
+#include "core/headless/HeadlessAudioCreator.h"
+
+// microbenchmarks of the core hot paths, results are printed as json lines (or csv with --csv) so they can be
+// collected per commit
+namespace {
+    struct BenchmarkResult {
+        std::string name;
+        unsigned int param;
+        unsigned long long iterations;
+        double ns_per_op;
+    };
+
+    struct BenchmarkOptions {
+        bool csv{false};
+        std::string filter;
+        std::string label;
+        unsigned int repeats{5};
+        double min_time{0.05};
+    };
+
+    // keeps the compiler from optimizing the benchmarked work away
+    volatile unsigned long long sink;
+
+    template<typename T>
+    void doNotOptimize(const T &value) {
+        sink = sink + static_cast<unsigned long long>(value);
+    }
+
+    class Benchmarks {
+    private:
+        BenchmarkOptions _options;
+        std::vector<BenchmarkResult> _results;
+
+    public:
+        explicit Benchmarks(BenchmarkOptions options) : _options(std::move(options)) {}
+
+        // body runs the operation `iterations` times, the iteration count grows until a run takes min_time
+        void run(const std::string &name, unsigned int param,
+                 const std::function<void(unsigned long long iterations)> &body) {
+            if (!_options.filter.empty() && name.find(_options.filter) == std::string::npos) return;
+
+            unsigned long long iterations = 1;
+            double elapsed = 0;
+            while (true) {
+                elapsed = time(body, iterations);
+                if (elapsed >= _options.min_time || iterations >= (1ull << 32)) break;
+                double growth = elapsed > 0 ? std::clamp(_options.min_time / elapsed * 1.2, 2.0, 10.0) : 10.0;
+                iterations = static_cast<unsigned long long>(static_cast<double>(iterations) * growth);
+            }
+
+            // the median of the repeats is less sensitive to scheduler noise than the mean
+            std::vector<double> samples = {elapsed};
+            for (unsigned int i = 1; i < _options.repeats; i++) {
+                samples.push_back(time(body, iterations));
+            }
+            std::sort(samples.begin(), samples.end());
+            double median = samples[samples.size() / 2];
+
+            _results.push_back({name, param, iterations, median * 1e9 / static_cast<double>(iterations)});
+            print(_results.back());
+        }
+
+        void printHeader() const {
+            if (_options.csv) std::cout << "label,name,param,iterations,ns_per_op,ops_per_sec" << std::endl;
+        }
+
+    private:
+        static double time(const std::function<void(unsigned long long)> &body, unsigned long long iterations) {
+            auto start = std::chrono::steady_clock::now();
+            body(iterations);
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            return elapsed.count();
+        }
+
+        void print(const BenchmarkResult &result) const {
+            double ops_per_sec = result.ns_per_op > 0 ? 1e9 / result.ns_per_op : 0;
+
+            if (_options.csv) {
+                std::cout << _options.label << "," << result.name << "," << result.param << "," << result.iterations
+                          << "," << result.ns_per_op << "," << ops_per_sec << std::endl;
+            } else {
+                std::cout << R"({"label":")" << _options.label << R"(","name":")" << result.name
+                          << R"(","param":)" << result.param << R"(,"iterations":)" << result.iterations
+                          << R"(,"ns_per_op":)" << result.ns_per_op << R"(,"ops_per_sec":)" << ops_per_sec << "}"
+                          << std::endl;
+            }
+        }
+    };
+
+    // inputs are generated up front so only the benchmarked call is timed
+    constexpr unsigned int input_count = 1024;
+
+    // fixed seed so runs of different commits measure the same work
+    Random input_random(0);
+
+    std::vector<Hitbox> randomHitboxes() {
+        std::vector<Hitbox> hitboxes;
+        hitboxes.reserve(input_count);
+        for (unsigned int i = 0; i < input_count; i++) {
+            hitboxes.emplace_back(Vector2f(input_random.uniform_real(-1, 1),
+                                           input_random.uniform_real(-1, 1)),
+                                  Vector2f(input_random.uniform_real(0.1f, 0.5f),
+                                           input_random.uniform_real(0.1f, 0.5f)));
+        }
+        return hitboxes;
+    }
+
+    std::vector<Vector2f> randomPoints() {
+        std::vector<Vector2f> points;
+        points.reserve(input_count);
+        for (unsigned int i = 0; i < input_count; i++) {
+            points.emplace_back(input_random.uniform_real(-1, 1), input_random.uniform_real(-1, 1));
+        }
+        return points;
+    }
+
+    class CountingObserver : public IObserver {
+    public:
+        unsigned long long events{0};
+
+        void handleEvent() override { events++; }
+
+        void handleEvent(const unsigned int &event, const unsigned int &) override { events += event; }
+    };
+
+    void benchmarkCollisions(Benchmarks &benchmarks) {
+        std::vector<Hitbox> hitboxes = randomHitboxes();
+        std::vector<Vector2f> points = randomPoints();
+
+        benchmarks.run("hitbox_collides", 0, [&](unsigned long long iterations) {
+            for (unsigned long long i = 0; i < iterations; i++) {
+                doNotOptimize(hitboxes[i % input_count].collides(hitboxes[(i * 7 + 1) % input_count]));
+            }
+        });
+
+        benchmarks.run("hitbox_collides_point", 0, [&](unsigned long long iterations) {
+            for (unsigned long long i = 0; i < iterations; i++) {
+                doNotOptimize(hitboxes[i % input_count].collides(points[(i * 7 + 1) % input_count]));
+            }
+        });
+
+        benchmarks.run("hitbox_displacement_to_collision", 0, [&](unsigned long long iterations) {
+            for (unsigned long long i = 0; i < iterations; i++) {
+                Vector2f displacement = hitboxes[i % input_count].getDisplacementToCollision(
+                        hitboxes[(i * 7 + 1) % input_count]);
+                doNotOptimize(displacement.x != 0);
+            }
+        });
+
+        std::vector<Ray> rays;
+        rays.reserve(input_count);
+        for (unsigned int i = 0; i < input_count; i++) {
+            rays.emplace_back(points[i], points[(i * 13 + 5) % input_count]);
+        }
+
+        benchmarks.run("ray_collides_ray", 0, [&](unsigned long long iterations) {
+            for (unsigned long long i = 0; i < iterations; i++) {
+                doNotOptimize(rays[i % input_count].collides(rays[(i * 7 + 1) % input_count]));
+            }
+        });
+
+        benchmarks.run("ray_collides_hitbox", 0, [&](unsigned long long iterations) {
+            for (unsigned long long i = 0; i < iterations; i++) {
+                doNotOptimize(rays[i % input_count].collides(hitboxes[(i * 7 + 1) % input_count]));
+            }
+        });
+
+        benchmarks.run("linesegment_intersection", 0, [&](unsigned long long iterations) {
+            Vector2f intersection1;
+            Vector2f intersection2;
+            bool is_collinear;
+            for (unsigned long long i = 0; i < iterations; i++) {
+                doNotOptimize(linesegmentIntersection(points[i % input_count], points[(i + 1) % input_count],
+                                                      points[(i * 7 + 2) % input_count],
+                                                      points[(i * 7 + 3) % input_count],
+                                                      intersection1, intersection2, is_collinear));
+            }
+        });
+    }
+
+    void benchmarkAnimation(Benchmarks &benchmarks) {
+        std::shared_ptr<AnimationSet> animations = std::make_shared<AnimationSet>();
+        AnimationPlayer animation_player(TextureGroup::adventurer, animations);
+        animation_player.addAnimation(AnimationId::idle, {{0, 1, 2, 3, 4, 5, 6, 7}, 0.25f, true});
+        animation_player.startAnimation(AnimationId::idle);
+
+        benchmarks.run("animation_player_advance", 0, [&](unsigned long long iterations) {
+            for (unsigned long long i = 0; i < iterations; i++) {
+                doNotOptimize(animation_player.advanceAnimation());
+            }
+        });
+    }
+
+    void benchmarkObservers(Benchmarks &benchmarks) {
+        for (unsigned int observer_count: {1u, 4u, 16u}) {
+            ISubject subject;
+            std::vector<std::shared_ptr<CountingObserver>> observers;
+            for (unsigned int i = 0; i < observer_count; i++) {
+                observers.push_back(std::make_shared<CountingObserver>());
+                subject.addObserver(observers.back());
+            }
+
+            benchmarks.run("subject_notify_observers", observer_count, [&](unsigned long long iterations) {
+                for (unsigned long long i = 0; i < iterations; i++) {
+                    subject.notifyObservers();
+                }
+            });
+
+            benchmarks.run("subject_notify_observers_event", observer_count, [&](unsigned long long iterations) {
+                for (unsigned long long i = 0; i < iterations; i++) {
+                    subject.notifyObservers(1, 3);
+                }
+            });
+
+            doNotOptimize(observers.front()->events);
+        }
+    }
+
+    void benchmarkPhysicsEntity(Benchmarks &benchmarks) {
+        std::shared_ptr<Camera> camera = std::make_shared<Camera>(0, 800, 1200, 0);
+        float dt = Stopwatch().getPhysicsDeltaTime();
+
+        std::vector<PhysicsEntity> entities;
+        entities.reserve(input_count);
+        std::vector<Vector2f> points = randomPoints();
+        for (unsigned int i = 0; i < input_count; i++) {
+            entities.emplace_back(points[i], camera, Vector2f(0.2f, 0.2f));
+            entities.back().setupPlayerPhysics(0.5f, 1.f);
+        }
+
+        benchmarks.run("physics_entity_update", 0, [&](unsigned long long iterations) {
+            double t = 0;
+            for (unsigned long long i = 0; i < iterations; i++) {
+                PhysicsEntity &entity = entities[i % input_count];
+                entity.update(t, dt);
+
+                // keep the entities around the origin so the run stays representative
+                if (entity.getPosition().y < -10) entity.setPosition(points[i % input_count]);
+                t += dt;
+            }
+        });
+    }
+
+    void benchmarkWorld(Benchmarks &benchmarks) {
+        for (unsigned int platform_count: {0u, 64u, 256u, 1024u}) {
+            std::shared_ptr<Stopwatch> stopwatch = std::make_shared<Stopwatch>();
+            stopwatch->setCapFramerate(false);
+            float dt = stopwatch->getPhysicsDeltaTime();
+
+            World world(0, 800, 1200, 0, std::make_shared<HeadlessViewCreator>(),
+                        std::make_shared<HeadlessAudioCreator>(), stopwatch, std::make_shared<Random>(0));
+            world.requestDebugMode();
+            stopwatch->advanceFrame(dt);
+            world.update();
+            world.spawnRandomPlatforms(platform_count);
+
+            // one frame of the physics delta time advances the world by a single tick
+            benchmarks.run("world_tick", world.getPhysicsEntityCount(), [&](unsigned long long iterations) {
+                for (unsigned long long i = 0; i < iterations; i++) {
+                    stopwatch->advanceFrame(dt);
+                    world.update();
+                }
+            });
+        }
+    }
+
+    // tick time of the stress scene as the amount of every entity kind grows
+    void benchmarkStress(Benchmarks &benchmarks) {
+        for (unsigned int n: {1u, 4u, 16u, 64u, 256u}) {
+            std::shared_ptr<Stopwatch> stopwatch = std::make_shared<Stopwatch>();
+            stopwatch->setCapFramerate(false);
+            float dt = stopwatch->getPhysicsDeltaTime();
+
+            World world(0, 800, 1200, 0, std::make_shared<HeadlessViewCreator>(),
+                        std::make_shared<HeadlessAudioCreator>(), stopwatch, std::make_shared<Random>(0));
+
+            StressConfig stress_config;
+            stress_config.platforms_per_type = n;
+            stress_config.enemies = n;
+            stress_config.bonuses = n;
+            stress_config.background = true;
+            world.requestStressMode(stress_config);
+            stopwatch->advanceFrame(dt);
+            world.update();
+
+            benchmarks.run("stress_tick", n, [&](unsigned long long iterations) {
+                for (unsigned long long i = 0; i < iterations; i++) {
+                    stopwatch->advanceFrame(dt);
+                    world.update();
+                }
+            });
+        }
+    }
+}
+
+int main(int argc, char *argv[]) {
+    BenchmarkOptions options;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--csv") == 0) {
+            options.csv = true;
+        } else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            options.filter = argv[++i];
+        } else if (std::strcmp(argv[i], "--label") == 0 && i + 1 < argc) {
+            options.label = argv[++i];
+        } else if (std::strcmp(argv[i], "--repeats") == 0 && i + 1 < argc) {
+            options.repeats = std::max(std::stoi(argv[++i]), 1);
+        } else if (std::strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) {
+            options.min_time = std::stod(argv[++i]);
+        } else {
+            std::cerr << "usage: " << argv[0]
+                      << " [--csv] [--filter name] [--label label] [--repeats n] [--min-time seconds]" << std::endl;
+            return 1;
+        }
+    }
+
+    Benchmarks benchmarks(options);
+    benchmarks.printHeader();
+
+    benchmarkCollisions(benchmarks);
+    benchmarkAnimation(benchmarks);
+    benchmarkObservers(benchmarks);
+    benchmarkPhysicsEntity(benchmarks);
+    benchmarkWorld(benchmarks);
+    benchmarkStress(benchmarks);
+
+    return 0;
+}
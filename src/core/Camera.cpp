@@ -4,7 +4,7 @@ Camera::Camera(float x_min, float x_max, float y_min, float y_max)
         : _camera_x_boundaries(constants::camera_view_x_min, constants::camera_view_x_max),
           _camera_y_boundaries(constants::camera_view_y_min, constants::camera_view_y_max),
           _screen_x_boundaries(x_min, x_max), _screen_y_boundaries(y_min, y_max),
-          _aspect_ratio(constants::aspect_ratio), _score_amount(0) {
+          _aspect_ratio(constants::aspect_ratio), _score_amount(0), _screen_version(0) {
     _position = {(_camera_x_boundaries.y + _camera_x_boundaries.x) / 2,
                  (_camera_y_boundaries.y + _camera_y_boundaries.x) / 2};
 
@@ -20,8 +20,7 @@ void Camera::move(const Vector2f &vector) {
     _camera_y_boundaries += vector.y;
     _position += vector;
 
-    // todo: score constant
-    _score_amount += vector.length() * 50;
+    _score_amount += vector.length() * constants::camera_score_per_unit;
     if (_score_amount > 1) {
         float score_amount = std::floor(_score_amount);
         _score_amount -= score_amount;
@@ -38,6 +37,8 @@ void Camera::reset() {
     _score_amount = 0;
 }
 
+unsigned long long Camera::getScreenVersion() const { return _screen_version; }
+
 Vector2f Camera::getXBounderies() const { return _camera_x_boundaries; }
 
 Vector2f Camera::getYBounderies() const { return _camera_y_boundaries; }
@@ -45,6 +46,7 @@ Vector2f Camera::getYBounderies() const { return _camera_y_boundaries; }
 void Camera::setBounderies(float x_min, float x_max, float y_min, float y_max) {
     _camera_x_boundaries = {x_min, x_max};
     _camera_y_boundaries = {y_min, y_max};
+    _screen_version++;
 }
 
 Vector2f Camera::getScreenXBoundaries() const { return _screen_x_boundaries; }
@@ -110,6 +112,8 @@ void Camera::updateSubscreenResolution() {
                                        middle_point - new_subscreen_resolution.y / 2};
         }
     }
+
+    _screen_version++;
 }
 
 bool Camera::isSidescreenHorizontal() const {
@@ -148,3 +152,14 @@ Vector2f Camera::projectCoordSubscreenToCore(const Vector2f &point) const {
 Vector2f Camera::projectSizeCoreToGame(const Vector2f &size) const {
     return {std::abs(getSubscreenWidth()) / getWidth() * size.x, std::abs(getSubscreenHeight()) / getHeight() * size.y};
 }
+
+Vector2f Camera::getProjectionScale() const {
+    return {getSubscreenWidth() / getWidth(), getSubscreenHeight() / getHeight()};
+}
+
+Vector2f Camera::getProjectionOffset() const {
+    Vector2f projection_scale = getProjectionScale();
+
+    return {_subscreen_x_boundaries.x - _camera_x_boundaries.x * projection_scale.x,
+            _subscreen_y_boundaries.x - _camera_y_boundaries.x * projection_scale.y};
+}
@@ -22,6 +22,10 @@ private:
 
     float _score_amount;
 
+    // increased when the world bounds or the screen resolution change, camera movement only changes the render
+    // transform and doesn't touch the entity views
+    unsigned long long _screen_version;
+
 public:
     Camera(float x_min, float x_max, float y_min, float y_max);
 
@@ -33,6 +37,8 @@ public:
 
     void reset();
 
+    unsigned long long getScreenVersion() const;
+
     Vector2f getXBounderies() const;
 
     Vector2f getYBounderies() const;
@@ -72,6 +78,11 @@ public:
     Vector2f projectCoordSubscreenToCore(const Vector2f &point) const;
 
     Vector2f projectSizeCoreToGame(const Vector2f &size) const;
+
+    // core to game projection as a single transform: game = core * scale + offset
+    Vector2f getProjectionScale() const;
+
+    Vector2f getProjectionOffset() const;
 };
 
 #endif // GAMEENGINE_CAMERA_H
@@ -4,9 +4,12 @@ Random::Random() : generator(device()) {
 
 }
 
-Random &Random::get_instance() {
-    static Random instance;
-    return instance;
+Random::Random(unsigned int seed) : generator(seed) {
+
+}
+
+void Random::seed(unsigned int seed) {
+    generator.seed(seed);
 }
 
 int Random::uniform_int(int a, int b) {
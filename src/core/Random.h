@@ -9,14 +9,17 @@ private:
     std::random_device device;
     std::mt19937 generator;
 
+public:
     Random();
 
-public:
+    explicit Random(unsigned int seed);
+
     Random(const Random &) = delete;
 
     Random &operator=(const Random &) = delete;
 
-    static Random &get_instance();
+    // reseeds the generator so runs can be reproduced
+    void seed(unsigned int seed);
 
     int uniform_int(int a, int b);
 
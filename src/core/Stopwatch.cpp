@@ -1,5 +1,7 @@
 #include "Stopwatch.h"
 
+#include <algorithm>
+
 #ifdef WIN32
 
 #include <windows.h>
@@ -45,15 +47,12 @@ Stopwatch::Stopwatch()
         : _a(std::chrono::steady_clock::now()), _b(std::chrono::steady_clock::now()), _fps_limit(60),
           _cap_framerate(true),
           _delta_time(0), _physics_delta_time(1.0f / 60), _physics_time(0), _accumulator(0), _physics_speed(1),
+          _max_physics_steps(5), _catch_up_policy(CatchUpPolicy::dilate), _physics_steps(0), _dropped_ticks(0),
+          _caught_up_ticks(0), _turbo_ticks(0), _turbo_uncapped(false), _turbo_display_rate(30),
           _sample_duration(500), _duration(0), _frame_count(0), _average_fps(0) {
     _ms_limit = (1000.f / static_cast<float>(_fps_limit));
 }
 
-Stopwatch &Stopwatch::getInstance() {
-    static Stopwatch instance;
-    return instance;
-}
-
 void Stopwatch::sleep_frame() {
     _a = std::chrono::steady_clock::now();
     std::chrono::duration<float> work_time = _a - _b;
@@ -85,6 +84,23 @@ void Stopwatch::sleep_frame() {
     }
 }
 
+void Stopwatch::advanceFrame(float delta_time) {
+    _a = std::chrono::steady_clock::now();
+    _b = _a;
+
+    // frame counter
+    _frame_count++;
+    _delta_time = delta_time * 1e3f;
+    _duration += _delta_time;
+
+    if (_duration >= _sample_duration) {
+        _average_fps = _frame_count / _duration * 1e3f;
+
+        _frame_count = 0;
+        _duration = 0;
+    }
+}
+
 float Stopwatch::getDeltaTime() const { return _delta_time * 1e-3f; }
 
 float Stopwatch::getPhysicsDeltaTime() const { return _physics_delta_time; }
@@ -107,6 +123,82 @@ void Stopwatch::decreaseAccumulator() { _accumulator -= _physics_delta_time; }
 
 float Stopwatch::computeAlpha() const { return _accumulator / _physics_delta_time; }
 
+unsigned int Stopwatch::getMaxPhysicsSteps() const { return _max_physics_steps; }
+
+void Stopwatch::setMaxPhysicsSteps(unsigned int max_physics_steps) {
+    _max_physics_steps = std::max(max_physics_steps, 1u);
+}
+
+CatchUpPolicy Stopwatch::getCatchUpPolicy() const { return _catch_up_policy; }
+
+void Stopwatch::setCatchUpPolicy(CatchUpPolicy catch_up_policy) { _catch_up_policy = catch_up_policy; }
+
+unsigned int Stopwatch::getPhysicsSteps() const { return _physics_steps; }
+
+void Stopwatch::resetPhysicsSteps() { _physics_steps = 0; }
+
+void Stopwatch::increasePhysicsSteps() {
+    _physics_steps++;
+
+    // every tick after the first one in a frame is catching up on a backlog
+    if (_physics_steps > 1 && !isTurbo()) _caught_up_ticks++;
+}
+
+bool Stopwatch::isPhysicsStepBudgetExceeded() const { return _physics_steps >= _max_physics_steps; }
+
+void Stopwatch::resolvePhysicsBacklog() {
+    float backlog_limit = 0;
+
+    if (_catch_up_policy == CatchUpPolicy::dilate) {
+        backlog_limit = static_cast<float>(_max_physics_steps) * _physics_delta_time;
+    }
+
+    if (_accumulator < backlog_limit + _physics_delta_time) return;
+
+    // drop whole ticks and keep the fractional remainder so the interpolation alpha stays valid
+    auto dropped_ticks = static_cast<unsigned long long>((_accumulator - backlog_limit) / _physics_delta_time);
+    _accumulator -= static_cast<float>(dropped_ticks) * _physics_delta_time;
+    _dropped_ticks += dropped_ticks;
+}
+
+unsigned long long Stopwatch::getDroppedTicks() const { return _dropped_ticks; }
+
+unsigned long long Stopwatch::getCaughtUpTicks() const { return _caught_up_ticks; }
+
+bool Stopwatch::isTurbo() const { return _turbo_ticks > 0 || _turbo_uncapped; }
+
+unsigned int Stopwatch::getTurboTicks() const { return _turbo_ticks; }
+
+void Stopwatch::setTurboTicks(unsigned int turbo_ticks) {
+    _turbo_ticks = turbo_ticks;
+    _accumulator = 0;
+}
+
+bool Stopwatch::getTurboUncapped() const { return _turbo_uncapped; }
+
+void Stopwatch::setTurboUncapped(bool turbo_uncapped) {
+    _turbo_uncapped = turbo_uncapped;
+    _accumulator = 0;
+}
+
+unsigned int Stopwatch::getTurboDisplayRate() const { return _turbo_display_rate; }
+
+void Stopwatch::setTurboDisplayRate(unsigned int turbo_display_rate) {
+    _turbo_display_rate = std::max(turbo_display_rate, 1u);
+}
+
+bool Stopwatch::isTurboFrameBudgetExceeded() const {
+    if (_physics_steps == 0) return false;
+
+    if (_turbo_uncapped) {
+        // the frame started when the last sleep ended, rendering comes on top so the display rate ends up a bit lower
+        std::chrono::duration<float> frame_time = std::chrono::steady_clock::now() - _b;
+        return frame_time.count() * static_cast<float>(_turbo_display_rate) >= 1.f;
+    }
+
+    return _physics_steps >= _turbo_ticks;
+}
+
 bool Stopwatch::getCapFramerate() const { return _cap_framerate; }
 
 void Stopwatch::setCapFramerate(bool cap_fps) { _cap_framerate = cap_fps; }
@@ -8,6 +8,13 @@
 #include <iostream>
 #include <thread>
 
+enum class CatchUpPolicy {
+    // discard the physics ticks that don't fit in the substep budget
+    drop,
+    // carry at most one budget of ticks over to the next frames, the simulation runs slower than real time
+    dilate
+};
+
 class Stopwatch {
     std::chrono::steady_clock::time_point _a;
     std::chrono::steady_clock::time_point _b;
@@ -21,22 +28,36 @@ class Stopwatch {
     float _physics_speed;
     float _accumulator;
 
+    // catch-up budget
+    unsigned int _max_physics_steps;
+    CatchUpPolicy _catch_up_policy;
+    unsigned int _physics_steps;
+    unsigned long long _dropped_ticks;
+    unsigned long long _caught_up_ticks;
+
+    // fast-forward, a fixed amount of physics ticks per rendered frame, 0 is off
+    unsigned int _turbo_ticks;
+    // runs ticks until the frame of the display rate is used up instead of a fixed amount
+    bool _turbo_uncapped;
+    unsigned int _turbo_display_rate;
+
     float _sample_duration;
     float _duration;
     float _frame_count;
     float _average_fps;
 
+public:
     Stopwatch();
 
-public:
     Stopwatch(const Stopwatch &) = delete;
 
     Stopwatch &operator=(const Stopwatch &) = delete;
 
-    static Stopwatch &getInstance();
-
     void sleep_frame();
 
+    // advances a frame of a fixed duration in seconds without sleeping, for headless runs
+    void advanceFrame(float delta_time);
+
     float getDeltaTime() const;
 
     float getPhysicsDeltaTime() const;
@@ -59,6 +80,46 @@ public:
 
     float computeAlpha() const;
 
+    unsigned int getMaxPhysicsSteps() const;
+
+    void setMaxPhysicsSteps(unsigned int max_physics_steps);
+
+    CatchUpPolicy getCatchUpPolicy() const;
+
+    void setCatchUpPolicy(CatchUpPolicy catch_up_policy);
+
+    unsigned int getPhysicsSteps() const;
+
+    void resetPhysicsSteps();
+
+    void increasePhysicsSteps();
+
+    bool isPhysicsStepBudgetExceeded() const;
+
+    void resolvePhysicsBacklog();
+
+    unsigned long long getDroppedTicks() const;
+
+    unsigned long long getCaughtUpTicks() const;
+
+    bool isTurbo() const;
+
+    unsigned int getTurboTicks() const;
+
+    // 0 turns the fixed turbo off, the accumulator is cleared so leaving turbo doesn't catch up on a backlog
+    void setTurboTicks(unsigned int turbo_ticks);
+
+    bool getTurboUncapped() const;
+
+    void setTurboUncapped(bool turbo_uncapped);
+
+    unsigned int getTurboDisplayRate() const;
+
+    void setTurboDisplayRate(unsigned int turbo_display_rate);
+
+    // always runs at least one tick per frame
+    bool isTurboFrameBudgetExceeded() const;
+
     bool getCapFramerate() const;
 
     void setCapFramerate(bool cap_fps);
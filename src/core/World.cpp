@@ -1,19 +1,26 @@
 #include "World.h"
+#include <cmath>
+#include <unordered_set>
 
 World::World(float x_min, float x_max, float y_min, float y_max,
              std::shared_ptr<IEntityViewCreator> entity_view_creator,
-             std::shared_ptr<IEntityAudioCreator> entity_audio_creator)
-        : _camera(new Camera(x_min, x_max, y_min, y_max)), _entity_view_creator(std::move(entity_view_creator)),
-          _entity_audio_creator(std::move(entity_audio_creator)), _force_static_view_update(true),
-          _input_map(new InputMap), _audio_listener_position(new Vector2f(0, 0)),
-          _start_debug_mode(new bool(false)), _debug_mode(false),
-          _start_doodle_mode(new bool(false)), _doodle_mode(false),
-          _start_pauze_overlay(new bool(false)), _pauze_overlay(false), _start_main_menu(new bool(false)),
-          _score(new Score()), _resume(new bool(false)), _gameover(false), _start_gameover(false),
-          _last_platform_y_pos(-1.f), _last_bg_tile_y_pos(-1.f),
-          _screen_ui_tree(craeteEmptyScreenUI()), _ingame_ui_tree(craeteEmptyScreenUI()) {
+             std::shared_ptr<IEntityAudioCreator> entity_audio_creator, std::shared_ptr<Stopwatch> stopwatch,
+             std::shared_ptr<Random> random)
+        : _stopwatch(std::move(stopwatch)), _random(std::move(random)), _census_time_passed(0),
+          _camera(new Camera(x_min, x_max, y_min, y_max)), _input_map(new InputMap), _score(new Score()),
+          _start_main_menu(new bool(false)), _start_debug_mode(new bool(false)), _debug_mode(false),
+          _stress_fire_time_passed(0), _start_doodle_mode(new bool(false)), _doodle_mode(false), _autopilot(false),
+          _autopilot_rising(false), _start_pauze_overlay(new bool(false)), _pauze_overlay(false),
+          _resume(new bool(false)), _start_gameover(false), _gameover(false),
+          _entity_view_creator(std::move(entity_view_creator)), _force_static_view_update(true),
+          _last_platform_y_pos(-1.f), _level_chunk_index(0), _screen_ui_tree(craeteEmptyScreenUI()),
+          _ingame_ui_tree(craeteEmptyScreenUI()), _last_bg_tile_y_pos(-1.f),
+          _particle_system(new ParticleSystem(constants::particles::capacity, _random)),
+          _entity_audio_creator(std::move(entity_audio_creator)),
+          _spatial_audio(constants::audio::max_distance, constants::audio::volume_step) {
 
     loadResources();
+    registerCensusTypes();
     initializeSideBars();
 
     loadStartMenu();
@@ -22,21 +29,58 @@ World::World(float x_min, float x_max, float y_min, float y_max,
 World::~World() = default;
 
 void World::sleep() {
-    Stopwatch::getInstance().sleep_frame();
+    _stopwatch->sleep_frame();
 }
 
 void World::update() {
-    gameUpdate(Stopwatch::getInstance().getPhysicsTime(), Stopwatch::getInstance().getDeltaTime());
+    _profiler.beginFrame();
 
-    if (!_pauze_overlay) {
-        Stopwatch::getInstance().increaseAccumulator();
-        while (Stopwatch::getInstance().getAccumulator() >= Stopwatch::getInstance().getPhysicsDeltaTime()) {
-            physicsUpdate(Stopwatch::getInstance().getPhysicsTime(), Stopwatch::getInstance().getPhysicsDeltaTime());
+    {
+        Profiler::Scope scope(_profiler, ProfilerPhase::game_update);
+        gameUpdate(_stopwatch->getPhysicsTime(), _stopwatch->getDeltaTime());
+    }
+
+    if (!_pauze_overlay && _stopwatch->isTurbo()) {
+        _stopwatch->resetPhysicsSteps();
+        // game over is started in the next game update, the ticks after it would only move the dead player
+        while (!_start_gameover && !_stopwatch->isTurboFrameBudgetExceeded()) {
+            physicsUpdate(_stopwatch->getPhysicsTime(), _stopwatch->getPhysicsDeltaTime());
+            _profiler.addTick();
 
-            Stopwatch::getInstance().increasePhysicsTime();
-            Stopwatch::getInstance().decreaseAccumulator();
+            _stopwatch->increasePhysicsTime();
+            _stopwatch->increasePhysicsSteps();
+        }
+    } else if (!_pauze_overlay) {
+        _stopwatch->increaseAccumulator();
+        _stopwatch->resetPhysicsSteps();
+        while (_stopwatch->getAccumulator() >= _stopwatch->getPhysicsDeltaTime()) {
+            // bounded catch-up: a hitch can't make a single frame run an unbounded amount of ticks
+            if (_stopwatch->isPhysicsStepBudgetExceeded()) {
+                _stopwatch->resolvePhysicsBacklog();
+                break;
+            }
+
+            physicsUpdate(_stopwatch->getPhysicsTime(), _stopwatch->getPhysicsDeltaTime());
+            _profiler.addTick();
+
+            _stopwatch->increasePhysicsTime();
+            _stopwatch->decreaseAccumulator();
+            _stopwatch->increasePhysicsSteps();
         }
     }
+
+    {
+        Profiler::Scope scope(_profiler, ProfilerPhase::lazy_views);
+        updateLazyViews();
+    }
+
+    _profiler.endFrame();
+
+    _census_time_passed += _stopwatch->getDeltaTime();
+    if (_census_time_passed >= constants::census::sample_interval) {
+        _census_time_passed = 0;
+        updateCensus();
+    }
 }
 
 void World::updateScreenResolution(float x_min, float x_max, float y_min, float y_max) {
@@ -55,69 +99,284 @@ std::shared_ptr<InputMap> World::getUserInputMap() {
     return _input_map;
 }
 
+std::shared_ptr<Camera> World::getCamera() const {
+    return _camera;
+}
+
+const std::shared_ptr<Stopwatch> &World::getStopwatch() const {
+    return _stopwatch;
+}
+
+const std::shared_ptr<Random> &World::getRandom() const {
+    return _random;
+}
+
+const Profiler &World::getProfiler() const {
+    return _profiler;
+}
+
+const Census &World::getCensus() const {
+    return _census;
+}
+
+void World::updateCensus() {
+    _census.beginSample();
+
+    // entities can be in several containers and in the ui trees, every entity is counted once
+    std::unordered_set<const Entity *> counted_entities;
+    std::size_t observers = 0;
+    auto add_entity = [this, &counted_entities, &observers](const Entity &entity) {
+        if (!counted_entities.insert(&entity).second) return;
+
+        _census.add(entity, entity.getApproximateHeapBytes() + Census::shared_control_block_bytes);
+        observers += entity.getObserverCount();
+    };
+
+    for (const auto &physics_entity: _physics_entities) {
+        if (std::shared_ptr<PhysicsEntity> physics_entity_shared = physics_entity.lock()) {
+            add_entity(*physics_entity_shared);
+        }
+    }
+
+    std::vector<std::shared_ptr<UIEntity>> ui_entities(_side_bars);
+    for (const auto &ui_entity: _ui_entities) {
+        if (std::shared_ptr<UIEntity> ui_entity_shared = ui_entity.lock()) {
+            ui_entities.push_back(ui_entity_shared);
+        }
+    }
+    while (!ui_entities.empty()) {
+        std::shared_ptr<UIEntity> ui_entity = ui_entities.back();
+        ui_entities.pop_back();
+
+        add_entity(*ui_entity);
+        ui_entities.insert(ui_entities.end(), ui_entity->getChildren().begin(), ui_entity->getChildren().end());
+    }
+
+    // a set node per observer, holding a shared pointer
+    std::size_t observer_node_bytes = 4 * sizeof(void *) + sizeof(std::shared_ptr<IObserver>);
+    _census.add("observers", observers, observers * observer_node_bytes);
+    _census.add("lazy_views", _lazy_views.size(), _lazy_views.capacity() * sizeof(LazyView));
+    _census.add("particles", _particle_system->getCount(),
+                _particle_system->getCapacity() * (7 * sizeof(float) + sizeof(ParticleEffect)));
+
+    _entity_view_creator->takeCensus(_census);
+}
+
+unsigned int World::getScore() const {
+    return _score->getScore();
+}
+
+bool World::isGameOver() const {
+    return _gameover;
+}
+
+void World::requestDebugMode() {
+    _stress_config = {};
+    *_start_debug_mode = true;
+}
+
+void World::requestDoodleMode(bool autopilot) {
+    _autopilot = autopilot;
+    _autopilot_rising = false;
+    _autopilot_target = constants::player::spawn_position;
+    *_start_doodle_mode = true;
+}
+
+void World::requestStressMode(const StressConfig &stress_config) {
+    _stress_config = stress_config;
+    *_start_debug_mode = true;
+}
+
+void World::spawnRandomPlatforms(unsigned int amount) {
+    float x_min = _camera->getPosition().x - _camera->getWidth() / 2;
+    float x_max = _camera->getPosition().x + _camera->getWidth() / 2;
+    float y_min = _camera->getPosition().y - _camera->getHeight() / 2;
+    float y_max = _camera->getPosition().y + _camera->getHeight() / 2;
+
+    for (unsigned int i = 0; i < amount; i++) {
+        PlatformSpawn platform_spawn;
+        platform_spawn.position = {_random->uniform_real(x_min, x_max),
+                                   _random->uniform_real(y_min, y_max)};
+        platform_spawn.type = static_cast<PlatformType>(
+                _random->uniform_int(0, static_cast<int>(PlatformType::vertical_teleporting)));
+        spawnPlatform(platform_spawn);
+    }
+}
+
+unsigned int World::getPhysicsEntityCount() const {
+    return _physics_entities.size();
+}
+
+void World::spawnBulletImpact(const Vector2f &position) {
+    _particle_system->spawnBurst(ParticleEffect::circle_explosion, position, constants::particles::impact_count,
+                                 constants::particles::impact_speed, constants::particles::impact_size,
+                                 constants::particles::impact_lifetime);
+}
+
+void World::spawnEnemyDeath(const Vector2f &position) {
+    _particle_system->spawn(ParticleEffect::explosion, position, {0, 0}, constants::particles::death_explosion_size,
+                            constants::particles::death_explosion_lifetime);
+    _particle_system->spawnBurst(ParticleEffect::circle_explosion, position, constants::particles::death_count,
+                                 constants::particles::death_speed, constants::particles::death_size,
+                                 constants::particles::death_lifetime);
+}
+
+void World::spawnJetpackTrail(const Vector2f &position) {
+    float drift = _random->uniform_real(-constants::particles::trail_drift, constants::particles::trail_drift);
+    _particle_system->spawn(ParticleEffect::circle_explosion, position, {drift, -constants::particles::trail_speed},
+                            constants::particles::trail_size, constants::particles::trail_lifetime);
+}
+
 void World::loadResources() {
     loadTextures();
     loadAnimations();
     loadAudio();
+    loadParticleEffects();
 }
 
 void World::loadTextures() {
     for (const auto &texture_resource: texture_data) {
-        _animation_players[texture_resource.first] = AnimationPlayer(texture_resource.first);
-        _entity_view_creator->loadTextureGroup(texture_resource.first, {texture_resource.second});
+        _animation_players[toIndex(texture_resource.id)] = AnimationPlayer(texture_resource.id);
+        _entity_view_creator->loadTextureGroup(texture_resource.id, {std::string(texture_resource.filename)});
     }
 }
 
 void World::loadAnimations() {
     for (const auto &animation_group_data: animation_groups_data) {
         std::vector<std::string> texture_filenames;
-        AnimationPlayer animation_player(animation_group_data.first);
+        AnimationPlayer animation_player(animation_group_data.id);
 
         unsigned int current_texture_index = 0;
-        for (const auto &animation_data_pair: animation_group_data.second) {
-            AnimationResource animation_data = animation_data_pair.second;
-
+        for (const auto &animation_data: animation_group_data.animations) {
             Animation animation;
             animation.framerate = animation_data.framerate;
             animation.loop = animation_data.loop;
 
             for (const auto &texture_filename: animation_data.texture_filenames) {
-                texture_filenames.push_back(texture_filename);
+                texture_filenames.emplace_back(texture_filename);
 
                 animation.texture_indeces.push_back(current_texture_index);
                 current_texture_index++;
             }
 
-            animation_player.addAnimation(animation_data_pair.first, animation);
+            animation_player.addAnimation(animation_data.id, animation);
         }
 
-        _animation_players.insert({animation_group_data.first, animation_player});
-        _entity_view_creator->loadTextureGroup(animation_group_data.first, texture_filenames);
+        _animation_players[toIndex(animation_group_data.id)] = animation_player;
+        _entity_view_creator->loadTextureGroup(animation_group_data.id, texture_filenames);
     }
 }
 
 void World::loadAudio() {
-    _audio_player.setAudioListenerPosition(_audio_listener_position);
-    _audio_player.setMaxDistance(2.f);
+    std::shared_ptr<SoundBank> sound_bank = std::make_shared<SoundBank>();
 
     for (const auto &audio_resource: audio_sound_data) {
-        unsigned int sound_id = _entity_audio_creator->loadSound(audio_resource.second);
+        unsigned int sound_id = _entity_audio_creator->loadSound(std::string(audio_resource.filename),
+                                                                 audio_resource.priority);
 
-        _audio_player.addSound(sound_id, audio_resource.first);
+        sound_bank->addSound(sound_id, audio_resource.id);
     }
 
     for (const auto &audio_resource: audio_music_data) {
-        unsigned int music_id = _entity_audio_creator->loadMusic(audio_resource.second);
+        unsigned int music_id = _entity_audio_creator->loadMusic(std::string(audio_resource.filename));
+
+        sound_bank->addMusic(music_id, audio_resource.id);
+    }
+
+    _sound_bank = sound_bank;
+}
+
+void World::loadParticleEffects() {
+    for (const auto &particle_effect: particle_effect_data) {
+        std::vector<std::string> texture_filenames(particle_effect.texture_filenames.begin(),
+                                                   particle_effect.texture_filenames.end());
+        _entity_view_creator->loadParticleEffect(particle_effect.id, texture_filenames);
+    }
+
+    // above the bullets, below the hp bars and side bars
+    _entity_view_creator->createParticleSystemView(_particle_system, 100);
+}
+
+const AnimationPlayer &World::getAnimationPlayer(TextureGroup texture_group) const {
+    return _animation_players[toIndex(texture_group)];
+}
+
+void World::createEntityAudio(const std::shared_ptr<Entity> &entity) {
+    _entity_audio_creator->createEntityAudio(entity);
+    _spatial_audio.addEntity(entity);
+}
+
+void World::createLazyEntitySpriteView(const std::shared_ptr<Entity> &entity, unsigned int layer) {
+    // the view is created by updateLazyViews at the end of the frame, spawned entities are often repositioned
+    _lazy_views.push_back({entity, layer, {}});
+}
+
+bool World::isInViewMargin(const Entity &entity, float margin) const {
+    Vector2f view_size = entity.getViewSize();
+    Vector2f scale = entity.getScale();
+    Vector2f half_size = {std::abs(view_size.x * scale.x) / 2 + margin, std::abs(view_size.y * scale.y) / 2 + margin};
+    Vector2f position = entity.getPosition();
+
+    return position.x + half_size.x >= _camera->getXBounderies().x &&
+           position.x - half_size.x <= _camera->getXBounderies().y &&
+           position.y + half_size.y >= _camera->getYBounderies().x &&
+           position.y - half_size.y <= _camera->getYBounderies().y;
+}
+
+void World::updateLazyViews() {
+    for (std::size_t i = 0; i < _lazy_views.size();) {
+        LazyView &lazy_view = _lazy_views[i];
+
+        if (lazy_view.entity.expired()) {
+            // the order doesn't matter, the last lazy view takes the place of the expired one so many entities
+            // dying in the same frame stays linear
+            if (i + 1 != _lazy_views.size()) lazy_view = std::move(_lazy_views.back());
+            _lazy_views.pop_back();
+            continue;
+        }
+
+        std::shared_ptr<Entity> entity = lazy_view.entity.lock();
+        std::shared_ptr<IObserver> view = lazy_view.view.lock();
 
-        _audio_player.addMusic(music_id, audio_resource.first);
+        if (!view && isInViewMargin(*entity, constants::view::create_margin)) {
+            lazy_view.view = _entity_view_creator->createEntitySpriteView(entity, lazy_view.layer);
+        } else if (view && !isInViewMargin(*entity, constants::view::release_margin)) {
+            // the entity holds the only owning reference, the view creator drops the expired view
+            entity->removeObserver(view);
+            lazy_view.view.reset();
+        }
+
+        i++;
     }
 }
 
+void World::registerCensusTypes() {
+    _census.registerType<Doodle>("Doodle");
+    _census.registerType<Wall>("Wall");
+    _census.registerType<Platform>("Platform");
+    _census.registerType<TempPlatform>("TempPlatform");
+    _census.registerType<MovPlatform>("MovPlatform");
+    _census.registerType<TelePlatform>("TelePlatform");
+    _census.registerType<SpringBonus>("SpringBonus");
+    _census.registerType<JetpackBonus>("JetpackBonus");
+    _census.registerType<SpikeBonus>("SpikeBonus");
+    _census.registerType<HPBonus>("HPBonus");
+    _census.registerType<Enemy>("Enemy");
+    _census.registerType<AdvancedEnemy>("AdvancedEnemy");
+    _census.registerType<PortalRadio>("PortalRadio");
+    _census.registerType<Bullet>("Bullet");
+    _census.registerType<UIEntity>("UIEntity");
+    _census.registerType<BgTile>("BgTile");
+    _census.registerType<Button>("Button");
+    _census.registerType<TextBox>("TextBox");
+    _census.registerType<HPBar>("HPBar");
+}
+
 void World::initializeSideBars() {
     // sidebars
     for (int i = 0; i < 2; i++) {
         _side_bars.push_back(std::make_shared<UIEntity>(
-                UIEntity({0, 0}, _camera, {1, 1}, _animation_players["black"])));
+                UIEntity({0, 0}, _camera, {1, 1}, getAnimationPlayer(TextureGroup::black))));
         _entity_view_creator->createEntitySpriteView(_side_bars.back(), 200);
     }
 
@@ -179,6 +438,9 @@ void World::clear() {
     _walls.clear();
     _platforms.clear();
     _last_platform_y_pos = -1.f;
+    _level_generator.stop();
+    _level_chunk.size = 0;
+    _level_chunk_index = 0;
     _bonuses.clear();
     _active_bonus = nullptr;
     _portal_radios.clear();
@@ -196,6 +458,9 @@ void World::clear() {
     _last_bg_tile_y_pos = -1.f;
     _buttons.clear();
     _enemy_hp_bars.clear();
+    _lazy_views.clear();
+    _particle_system->clear();
+    _spatial_audio.clear();
 }
 
 void World::gameUpdate(double t, float dt) {
@@ -294,20 +559,33 @@ void World::updateUIEntities(double t, float dt) {
 
 void World::physicsUpdate(double t, float dt) {
     // game logic
-    if (_gameover) {
-        updateGameOverMode(t, dt);
-    } else {
-        if (_debug_mode) {
-            updateDebugMode(t, dt);
-        } else if (_doodle_mode) {
-            updateDoodleMode(t, dt);
+    {
+        Profiler::Scope scope(_profiler, ProfilerPhase::mode_update);
+        if (_gameover) {
+            updateGameOverMode(t, dt);
+        } else {
+            if (_debug_mode) {
+                updateDebugMode(t, dt);
+            } else if (_doodle_mode) {
+                updateDoodleMode(t, dt);
+            }
         }
     }
 
     // physics entities update
-    updatePhysicsEntities(t, dt);
+    {
+        Profiler::Scope scope(_profiler, ProfilerPhase::physics_entities);
+        updatePhysicsEntities(t, dt);
+    }
+    {
+        Profiler::Scope scope(_profiler, ProfilerPhase::particles);
+        updateParticles(dt);
+    }
     // collisions update
-    updatePhysicsCollisions();
+    {
+        Profiler::Scope scope(_profiler, ProfilerPhase::collisions);
+        updatePhysicsCollisions();
+    }
 
     // update ui position
     _screen_ui_tree->setPosition(_camera->getPosition());
@@ -315,22 +593,58 @@ void World::physicsUpdate(double t, float dt) {
 }
 
 void World::updatePhysicsEntities(double t, float dt) {
+    // activity area, entities outside of it are put to sleep
+    Vector2f activity_margin = {constants::physics::activity_margin, constants::physics::activity_margin};
+    Vector2f activity_half_size = Vector2f(_camera->getWidth() / 2, _camera->getHeight() / 2) + activity_margin;
+    Vector2f activity_min = _camera->getPosition() - activity_half_size;
+    Vector2f activity_max = _camera->getPosition() + activity_half_size;
+    auto in_activity_area = [&activity_min, &activity_max](const Vector2f &position) {
+        return position.x >= activity_min.x && position.x <= activity_max.x &&
+               position.y >= activity_min.y && position.y <= activity_max.y;
+    };
+
     // update physics entities and delete expired weak physics entities pointers
     for (auto iter = _physics_entities.begin(); iter != _physics_entities.end();) {
         if (iter->expired()) {
             iter = _physics_entities.erase(iter);
-        } else {
-            iter->lock()->update(t, dt);
-            iter++;
+            continue;
         }
+
+        std::shared_ptr<PhysicsEntity> physics_entity = iter->lock();
+        iter++;
+
+        if (physics_entity->getSleepState() == SleepState::out_of_margin) {
+            if (!in_activity_area(physics_entity->getPosition())) continue;
+            physics_entity->wake();
+        } else if (physics_entity->getSleepState() == SleepState::resting) {
+            if (!in_activity_area(physics_entity->getPosition())) {
+                physics_entity->updateSleepState(false);
+            } else {
+                // only notifies the view when the camera changed
+                physics_entity->updateView();
+            }
+            continue;
+        }
+
+        physics_entity->update(t, dt);
+        physics_entity->updateSleepState(in_activity_area(physics_entity->getPosition()));
     }
 
     // audio listener
     if (_player != nullptr) {
-        *_audio_listener_position = _player->getPosition();
+        _spatial_audio.setListenerPosition(_player->getPosition());
     } else {
-        *_audio_listener_position = {0, 0};
+        _spatial_audio.setListenerPosition({0, 0});
     }
+    _spatial_audio.update();
+}
+
+void World::updateParticles(float dt) {
+    if (_player && _active_bonus && _active_bonus->hasTrail()) {
+        spawnJetpackTrail(_player->getPosition() - Vector2f(0, _player->getViewSize().y / 2));
+    }
+
+    _particle_system->update(dt);
 }
 
 void World::updatePhysicsCollisions() {
@@ -338,10 +652,16 @@ void World::updatePhysicsCollisions() {
     for (const auto &player_bullet: _player_bullets) {
         for (const auto &enemy_weak: _enemies) {
             std::shared_ptr<Enemy> enemy = enemy_weak.lock();
-            if (enemy) {
+            if (enemy && enemy->getSleepState() != SleepState::out_of_margin) {
                 if (handleCollision(player_bullet, enemy, false, false)) {
                     player_bullet->disappear();
+                    spawnBulletImpact(player_bullet->getPosition());
+
+                    bool was_alive = enemy->getCurrentHitPoints() > 0;
                     enemy->subtractHitPoints(1);
+                    if (was_alive && enemy->getCurrentHitPoints() == 0) {
+                        spawnEnemyDeath(enemy->getPosition());
+                    }
 
                     if (enemy->getCurrentHitPoints() > 0 && enemy->isShootBack()) {
                         spawnEnemyBullet(enemy->getPosition(), false);
@@ -353,6 +673,8 @@ void World::updatePhysicsCollisions() {
 
     if (_player && !_gameover) {
         for (const auto &platform: _platforms) {
+            if (platform->getSleepState() == SleepState::out_of_margin) continue;
+
             handleCollision(_player, platform, true, true);
 
             for (const auto &ray: _player->getRays()) {
@@ -365,6 +687,8 @@ void World::updatePhysicsCollisions() {
         // bonuses
         if (!_active_bonus) {
             for (const auto &bonus: _bonuses) {
+                if (bonus->getSleepState() == SleepState::out_of_margin) continue;
+
                 handleCollision(_player, bonus, true, false);
 
                 if (bonus->isCollided()) {
@@ -381,6 +705,7 @@ void World::updatePhysicsCollisions() {
         for (const auto &enemy_bullet: _enemy_bullets) {
             if (handleCollision(enemy_bullet, _player, false, false)) {
                 enemy_bullet->disappear();
+                spawnBulletImpact(enemy_bullet->getPosition());
                 _player->subtractHitPoints(1);
                 // todo: constants
                 _score->substractScore(100);
@@ -388,6 +713,8 @@ void World::updatePhysicsCollisions() {
         }
 
         for (const auto &wall: _walls) {
+            if (wall->getSleepState() == SleepState::out_of_margin) continue;
+
             handleCollision(_player, wall);
 
             for (const auto &ray: _player->getRays()) {
@@ -413,32 +740,51 @@ void World::updatePhysicsCollisions() {
 
 void World::handleUpdatePhysicsSpeed() {
     if (_input_map->z) {
-        Stopwatch::getInstance().setPhysicsSpeed(1);
+        _stopwatch->setTurboTicks(0);
+        _stopwatch->setTurboUncapped(false);
+        _stopwatch->setPhysicsSpeed(1);
     }
 
     if (_input_map->x) {
-        Stopwatch::getInstance().setPhysicsSpeed(1.f / 60);
+        _stopwatch->setTurboTicks(0);
+        _stopwatch->setTurboUncapped(false);
+        _stopwatch->setPhysicsSpeed(1.f / 60);
+    }
+
+    // turbo, rendered frames only show every few physics ticks
+    if (_input_map->c) {
+        _stopwatch->setTurboUncapped(false);
+        _stopwatch->setTurboTicks(constants::turbo::ticks_per_frame);
+    }
+
+    if (_input_map->v) {
+        _stopwatch->setTurboTicks(0);
+        _stopwatch->setTurboUncapped(true);
     }
 }
 
 void World::loadStartMenu() {
+    // the menu buttons start the plain debug scene and a doodle mode played by the user
+    _stress_config = {};
+    _autopilot = false;
+
     // ui screen and background
     _screen_ui_tree = std::make_shared<UIEntity>(
             UIEntity({0, 1.5f}, _camera, {_camera->getWidth(), _camera->getHeight()},
-                     _animation_players["background"], {}, false));
+                     getAnimationPlayer(TextureGroup::background), {}, false));
     _ui_entities.push_back(_screen_ui_tree);
     _entity_view_creator->createEntitySpriteView(_screen_ui_tree, 1);
 
     // menu frame
     std::shared_ptr<UIEntity> menu = std::make_shared<UIEntity>(
             UIEntity({0, 0}, _camera, {1.f, 1.5f},
-                     _animation_players["menu"]));
+                     getAnimationPlayer(TextureGroup::menu)));
     _entity_view_creator->createEntitySpriteView(menu, 1);
     _screen_ui_tree->addChild(menu, _screen_ui_tree);
 
     // play button
     std::shared_ptr<Button> button = std::make_shared<Button>(
-            Button({0, 0.5f}, _camera, {0.5f, 0.25f}, _animation_players["button"]));
+            Button({0, 0.5f}, _camera, {0.5f, 0.25f}, getAnimationPlayer(TextureGroup::button)));
     menu->addChild(button, menu);
     _buttons.push_back(button);
     _entity_view_creator->createEntitySpriteView(button, 2);
@@ -451,7 +797,8 @@ void World::loadStartMenu() {
     _entity_view_creator->createEntityTextView(text_box);
 
     // debug button
-    button = std::make_shared<Button>(Button({0, 0.125f}, _camera, {0.5f, 0.25f}, _animation_players["button"]));
+    button = std::make_shared<Button>(
+            Button({0, 0.125f}, _camera, {0.5f, 0.25f}, getAnimationPlayer(TextureGroup::button)));
     menu->addChild(button, menu);
     _buttons.push_back(button);
     _entity_view_creator->createEntitySpriteView(button, 2);
@@ -468,7 +815,7 @@ void World::loadPauseOverlayButton() {
     Vector2f button_size = {0.2f, 0.2f};
     std::shared_ptr<Button> button = std::make_shared<Button>(
             Button({_camera->getWidth() / 2 - button_size.x, _camera->getHeight() / 2 - button_size.y}, _camera,
-                   button_size, _animation_players["hamburger"]));
+                   button_size, getAnimationPlayer(TextureGroup::hamburger)));
     _screen_ui_tree->addChild(button, _screen_ui_tree);
     _buttons.push_back(button);
     _entity_view_creator->createEntitySpriteView(button, 500);
@@ -482,13 +829,13 @@ void World::startPauzeOverlay() {
     // menu frame
     std::shared_ptr<UIEntity> menu = std::make_shared<UIEntity>(
             UIEntity({0, 0}, _camera, {1.f, 1.5f},
-                     _animation_players["menu"]));
+                     getAnimationPlayer(TextureGroup::menu)));
     _entity_view_creator->createEntitySpriteView(menu, layer);
     _screen_ui_tree->addChild(menu, _screen_ui_tree);
 
     // resume button
     std::shared_ptr button = std::make_shared<Button>(
-            Button({0, 0.5f}, _camera, {0.5f, 0.25f}, _animation_players["button"]));
+            Button({0, 0.5f}, _camera, {0.5f, 0.25f}, getAnimationPlayer(TextureGroup::button)));
     menu->addChild(button, menu);
     _buttons.push_back(button);
     _entity_view_creator->createEntitySpriteView(button, layer + 1);
@@ -501,7 +848,8 @@ void World::startPauzeOverlay() {
     _entity_view_creator->createEntityTextView(text_box);
 
     // restart button
-    button = std::make_shared<Button>(Button({0, 0.125f}, _camera, {0.5f, 0.25f}, _animation_players["button"]));
+    button = std::make_shared<Button>(
+            Button({0, 0.125f}, _camera, {0.5f, 0.25f}, getAnimationPlayer(TextureGroup::button)));
     menu->addChild(button, menu);
     _buttons.push_back(button);
     _entity_view_creator->createEntitySpriteView(button, layer + 1);
@@ -518,7 +866,8 @@ void World::startPauzeOverlay() {
     _entity_view_creator->createEntityTextView(text_box);
 
     // return to menu button
-    button = std::make_shared<Button>(Button({0, -0.25f}, _camera, {0.5f, 0.25f}, _animation_players["button"]));
+    button = std::make_shared<Button>(
+            Button({0, -0.25f}, _camera, {0.5f, 0.25f}, getAnimationPlayer(TextureGroup::button)));
     menu->addChild(button, menu);
     _buttons.push_back(button);
     _entity_view_creator->createEntitySpriteView(button, layer + 1);
@@ -540,7 +889,7 @@ void World::startGameoverOverlay() {
     // menu
     std::shared_ptr<UIEntity> menu = std::make_shared<UIEntity>(
             UIEntity({0, 0}, _camera, {1.f, 1.5f},
-                     _animation_players["menu"]));
+                     getAnimationPlayer(TextureGroup::menu)));
     _entity_view_creator->createEntitySpriteView(menu, layer);
     _screen_ui_tree->addChild(menu, _screen_ui_tree);
 
@@ -552,7 +901,7 @@ void World::startGameoverOverlay() {
     _entity_view_creator->createEntityTextView(text_box);
 
     std::shared_ptr button = std::make_shared<Button>(
-            Button({0, 0.125f}, _camera, {0.5f, 0.25f}, _animation_players["button"]));
+            Button({0, 0.125f}, _camera, {0.5f, 0.25f}, getAnimationPlayer(TextureGroup::button)));
     menu->addChild(button, menu);
     _buttons.push_back(button);
     _entity_view_creator->createEntitySpriteView(button, layer + 1);
@@ -568,7 +917,8 @@ void World::startGameoverOverlay() {
     button->addChild(text_box, button);
     _entity_view_creator->createEntityTextView(text_box);
 
-    button = std::make_shared<Button>(Button({0, -0.25f}, _camera, {0.5f, 0.25f}, _animation_players["button"]));
+    button = std::make_shared<Button>(
+            Button({0, -0.25f}, _camera, {0.5f, 0.25f}, getAnimationPlayer(TextureGroup::button)));
     menu->addChild(button, menu);
     _buttons.push_back(button);
     _entity_view_creator->createEntitySpriteView(button, layer + 1);
@@ -613,8 +963,8 @@ void World::startDebugMode() {
     loadPauseOverlayButton();
 
     std::shared_ptr<UIEntity> background = std::make_shared<UIEntity>(
-            UIEntity({0, 0}, _camera, {_camera->getWidth(), _camera->getHeight()}, _animation_players["background"],
-                     {}, false));
+            UIEntity({0, 0}, _camera, {_camera->getWidth(), _camera->getHeight()},
+                     getAnimationPlayer(TextureGroup::background), {}, false));
     _ingame_ui_tree->addChild(background, _ingame_ui_tree);
     _entity_view_creator->createEntitySpriteView(background, 1);
 
@@ -623,48 +973,55 @@ void World::startDebugMode() {
     // portal radio music object
     _portal_radios.push_back(
             std::make_shared<PortalRadio>(
-                    PortalRadio({0.5f, 2.5f}, _camera, {0.2f, 0.2f}, _animation_players["portal_radio"],
-                                _audio_player)));
+                    PortalRadio({0.5f, 2.5f}, _camera, {0.2f, 0.2f}, getAnimationPlayer(TextureGroup::portal_radio),
+                                AudioPlayer(_sound_bank))));
     _physics_entities.push_back(_portal_radios.back());
     _entity_view_creator->createEntitySpriteView(_portal_radios.back(), 4);
-//    _entity_audio_creator->createEntityAudio(_portal_radios.back());
+//    createEntityAudio(_portal_radios.back());
 
     // walls
     _walls.push_back(std::make_shared<Wall>(
-            Wall({-0.5f, 0.f}, _camera, {1.f, 1.f}, _animation_players["wall"], {}, true)));
+            Wall({-0.5f, 0.f}, _camera, {1.f, 1.f}, getAnimationPlayer(TextureGroup::wall), {}, true)));
     _physics_entities.push_back(_walls.back());
     _entity_view_creator->createEntitySpriteView(_walls.back(), 3);
 
     _walls.push_back(std::make_shared<Wall>(
-            Wall({0.5f, 0.f}, _camera, {1.f, 1.f}, _animation_players["wall"], {}, true)));
+            Wall({0.5f, 0.f}, _camera, {1.f, 1.f}, getAnimationPlayer(TextureGroup::wall), {}, true)));
     _physics_entities.push_back(_walls.back());
     _entity_view_creator->createEntitySpriteView(_walls.back(), 3);
 
     std::shared_ptr<Enemy> enemy = std::make_shared<AdvancedEnemy>(
-            AdvancedEnemy({0, 0}, _camera, {0.2f, 0.26f}, _animation_players["skeleton_red"]));
+            AdvancedEnemy({0, 0}, _camera, {0.2f, 0.26f}, getAnimationPlayer(TextureGroup::skeleton_red)));
     _physics_entities.push_back(enemy);
     _bonuses.push_back(enemy);
     _enemies.push_back(enemy);
-    _entity_view_creator->createEntitySpriteView(_bonuses.back(), 4);
+    createLazyEntitySpriteView(_bonuses.back(), 4);
 
-    std::shared_ptr<HPBar> hp_bar = createHPBar(enemy, false, constants::hpbarhearts::entity_ui_size,
+    std::shared_ptr<HPBar> hp_bar = createHPBar(enemy, constants::hpbarhearts::entity_ui_size,
                                                 {0, (enemy->getViewSize().y / 2) +
                                                     (constants::hpbarhearts::entity_ui_size.y / 2)});
     enemy->setHPBar(hp_bar);
     _ui_entities.push_back(hp_bar);
 
     _platforms.push_back(std::make_shared<Platform>(
-            Platform({-0.5f, 1.f}, _camera, {0.4f, 0.1f}, _animation_players["green"])));
+            Platform({-0.5f, 1.f}, _camera, {0.4f, 0.1f}, getAnimationPlayer(TextureGroup::green))));
     _physics_entities.push_back(_platforms.back());
-    _entity_view_creator->createEntitySpriteView(_platforms.back(), 3);
+    createLazyEntitySpriteView(_platforms.back(), 3);
 
     // add bonus
-    _platforms.back()->addBonus(_bonuses.back());
+    _platforms.back()->addBonus(_bonuses.back(), *_random);
     _bonuses.back()->addObserver(_score);
+
+    if (!_stress_config.empty()) {
+        spawnStressScene();
+    }
 }
 
 void World::updateDebugMode(double t, float dt) {
-    _camera->setPosition({_camera->getPosition().x, _player->getPosition().y});
+    // the stress scene keeps the camera still so the amount of active entities doesn't depend on the player
+    if (_stress_config.empty()) {
+        _camera->setPosition({_camera->getPosition().x, _player->getPosition().y});
+    }
 
     if (_input_map->f && _player->canShoot()) {
         _player->setCanShoot(false);
@@ -674,6 +1031,80 @@ void World::updateDebugMode(double t, float dt) {
     if (_input_map->k) {
         _start_gameover = true;
     }
+
+    if (!_stress_config.empty()) {
+        updateStressScene(dt);
+    }
+}
+
+void World::spawnStressScene() {
+    _stress_fire_time_passed = 0;
+
+    float x_min = _camera->getPosition().x - _camera->getWidth() / 2;
+    float x_max = _camera->getPosition().x + _camera->getWidth() / 2;
+    float y_min = _camera->getPosition().y - _camera->getHeight() / 2;
+    float y_max = _camera->getPosition().y + _camera->getHeight() / 2;
+    auto random_position = [this, x_min, x_max, y_min, y_max]() {
+        return Vector2f(_random->uniform_real(x_min, x_max),
+                        _random->uniform_real(y_min, y_max));
+    };
+
+    // everything is spawned inside the camera view so it stays in the activity area, the worst case for the update
+    PlatformSpawn platform_spawn;
+    for (unsigned int type = 0; type <= static_cast<unsigned int>(PlatformType::vertical_teleporting); type++) {
+        platform_spawn.type = static_cast<PlatformType>(type);
+        for (unsigned int i = 0; i < _stress_config.platforms_per_type; i++) {
+            platform_spawn.position = random_position();
+            spawnPlatform(platform_spawn);
+        }
+    }
+
+    platform_spawn.type = PlatformType::static_platform;
+    for (unsigned int i = 0; i < _stress_config.enemies; i++) {
+        platform_spawn.position = random_position();
+        platform_spawn.bonus = i % 2 == 0 ? BonusType::enemy : BonusType::advanced_enemy;
+        spawnPlatform(platform_spawn);
+    }
+
+    constexpr std::array<BonusType, 4> bonus_types = {BonusType::spring, BonusType::jetpack, BonusType::spikes,
+                                                      BonusType::heart};
+    for (unsigned int i = 0; i < _stress_config.bonuses; i++) {
+        platform_spawn.position = random_position();
+        platform_spawn.bonus = bonus_types[i % bonus_types.size()];
+        spawnPlatform(platform_spawn);
+    }
+
+    if (_stress_config.background) {
+        _last_bg_tile_y_pos = y_min;
+        spawnBgTiles(y_max, true);
+    }
+}
+
+void World::updateStressScene(float dt) {
+    _stress_fire_time_passed += dt;
+
+    if (_stress_fire_time_passed >= _stress_config.enemy_fire_interval) {
+        _stress_fire_time_passed = 0;
+
+        for (const auto &enemy_weak: _enemies) {
+            std::shared_ptr<Enemy> enemy = enemy_weak.lock();
+            if (enemy && enemy->getCurrentHitPoints() > 0 && enemy->getSleepState() != SleepState::out_of_margin) {
+                spawnEnemyBullet(enemy->getPosition() - Vector2f(0, enemy->getViewSize().y / 2), false);
+            }
+        }
+    }
+
+    destroyOutOfRangeBullets();
+}
+
+void World::destroyOutOfRangeBullets() {
+    float max_distance = _camera->getHeight() / 2 + constants::physics::activity_margin;
+    auto out_of_range = [this, max_distance](const std::shared_ptr<Bullet> &bullet) {
+        return std::abs(bullet->getPosition().y - _camera->getPosition().y) > max_distance;
+    };
+
+    std::erase_if(_player_bullets, out_of_range);
+    std::erase_if(_enemy_bullets, out_of_range);
 }
 
 void World::startDoodleMode() {
@@ -687,6 +1118,8 @@ void World::startDoodleMode() {
     spawnPlayer();
     _player->addVelocity({0.f, _player->getInitialJumpVelocity() * 1.2f});
 
+    unsigned int level_seed = _random->uniform_int(0, std::numeric_limits<int>::max());
+    _level_generator.start(_last_platform_y_pos, level_seed);
     doodleModeSpawnPlatformsAndBonuses();
     spawnBgTiles(_camera->getPosition().y + _camera->getHeight(), true);
 
@@ -703,6 +1136,10 @@ void World::startDoodleMode() {
 }
 
 void World::updateDoodleMode(double t, float dt) {
+    if (_autopilot) {
+        updateAutopilot();
+    }
+
     // camera movement
     if (_player->getPosition().y > _camera->getPosition().y + 0.4f) {
         _camera->setPosition({_camera->getPosition().x, _player->getPosition().y - 0.4f});
@@ -732,130 +1169,41 @@ void World::updateDoodleMode(double t, float dt) {
     doodleModeDestroyPhysicsEntities();
 }
 
-void World::doodleModeSpawnPlatformsAndBonuses() {
-    // todo: constants
-    float platform_width = 0.4f;
-    float platform_height = 0.075f;
-    unsigned int platform_render_layer = 3;
-
-
-    float sig_val = sigmoid(static_cast<float>(_score->getScore()), 0.00125, 2);
-    float y_variation = Random::get_instance().uniform_real(-0.15f, 0.15f);
-
-//    std::cout << sig_val << std::endl;
-    Vector2f rand_y_bounderies = {0.1f, constants::player::jump_height - 0.1f};
+void World::updateAutopilot() {
+    // jumps on every landing, the target is picked when a jump starts and kept until the next one: the highest
+    // platform in reach
+    Vector2f player_position = _player->getPosition();
+    bool rising = _player->getVelocity().y > 0;
+    if (rising && !_autopilot_rising) {
+        float reach = constants::player::jump_height * 0.8f;
+        _autopilot_target = player_position;
+        for (const auto &platform: _platforms) {
+            Vector2f platform_position = platform->getPosition();
+            if (platform_position.y > _autopilot_target.y && platform_position.y < player_position.y + reach) {
+                _autopilot_target = platform_position;
+            }
+        }
+    }
+    _autopilot_rising = rising;
 
-//    std::cout << y_variation << std::endl;
-    float rand_y_distance = lerp(rand_y_bounderies.x, rand_y_bounderies.y, sig_val) + y_variation;
-    rand_y_distance = std::clamp(rand_y_distance, rand_y_bounderies.x, rand_y_bounderies.y);
+    _input_map->w = true;
+    _input_map->a = _autopilot_target.x < player_position.x - 0.05f;
+    _input_map->d = _autopilot_target.x > player_position.x + 0.05f;
+}
 
+void World::doodleModeSpawnPlatformsAndBonuses() {
+    // platform positions, types and bonuses are generated ahead of the camera by the level generator
     float y_spawn_pos = _camera->getPosition().y + (_camera->getHeight() / 2) * 1.1f;
     while (_last_platform_y_pos < y_spawn_pos) {
-        float x_pos = Random::get_instance().uniform_real(-0.8, 0.8);
-        _last_platform_y_pos += rand_y_distance;
-
-        float platform_type = Random::get_instance().uniform_real(0, sig_val);
-
-        if (platform_type <= 0.20f) {
-            // static platform
-            _platforms.push_back(std::make_shared<Platform>(
-                    Platform({x_pos, _last_platform_y_pos}, _camera, {platform_width, platform_height},
-                             _animation_players["green"])));
-
-        } else if (platform_type <= 0.40f) {
-            // temporary platform
-            _platforms.push_back(std::make_shared<TempPlatform>(
-                    TempPlatform({x_pos, _last_platform_y_pos}, _camera, {platform_width, platform_height},
-                                 _animation_players["white"])));
-        } else if (platform_type <= 0.55f) {
-            // moving platform
-            _platforms.push_back(std::make_shared<MovPlatform>(
-                    MovPlatform({x_pos, _last_platform_y_pos}, _camera, {platform_width, platform_height}, true,
-                                _animation_players["blue"])));
-
-        } else if (platform_type <= 0.70f) {
-            _platforms.push_back(std::make_shared<MovPlatform>(
-                    MovPlatform({x_pos, _last_platform_y_pos}, _camera, {platform_width, platform_height}, false,
-                                _animation_players["yellow"])));
-
-        } else if (platform_type <= 0.85f) {
-            // teleporting platform
-            _platforms.push_back(std::make_shared<TelePlatform>(
-                    TelePlatform({x_pos, _last_platform_y_pos}, _camera, {platform_width, platform_height}, true,
-                                 _animation_players["blue_redsides"])));
-
-        } else if (platform_type <= 1.f) {
-            _platforms.push_back(std::make_shared<TelePlatform>(
-                    TelePlatform({x_pos, _last_platform_y_pos}, _camera, {platform_width, platform_height}, false,
-                                 _animation_players["yellow_redsides"])));
+        if (_level_chunk_index >= _level_chunk.size) {
+            _level_generator.popChunk(_level_chunk);
+            _level_chunk_index = 0;
         }
 
-        _physics_entities.push_back(_platforms.back());
-        _entity_view_creator->createEntitySpriteView(_platforms.back(), platform_render_layer);
-
-        // bonus
-        int place_bonus = Random::get_instance().bernoulli(0.2f);
-
-        if (place_bonus) {
-            float bonus_type = Random::get_instance().uniform_real(0, sig_val);
-
-            if (bonus_type <= 0.30f) {
-                _bonuses.push_back(std::make_shared<SpringBonus>(
-                        SpringBonus({0, 0}, _camera, {0.2f, 0.2f}, _animation_players["spring"])));
-                _physics_entities.push_back(_bonuses.back());
-                _entity_view_creator->createEntitySpriteView(_bonuses.back(), 4);
-            } else if (bonus_type <= 0.40f) {
-                _bonuses.push_back(std::make_shared<JetpackBonus>(
-                        JetpackBonus({0, 0}, _camera, {0.2f, 0.2f}, _animation_players["jetpack"])));
-                _physics_entities.push_back(_bonuses.back());
-                _entity_view_creator->createEntitySpriteView(_bonuses.back(), 4);
-            } else if (bonus_type <= 0.8f) {
-                float equal_rand_choice = Random::get_instance().uniform_real(0, 1);
-
-                if (equal_rand_choice <= 0.333f) {
-                    _bonuses.push_back(std::make_shared<SpikeBonus>(
-                            SpikeBonus({0, 0}, _camera, {0.15f, 0.075f}, _animation_players["spikes"])));
-                    _physics_entities.push_back(_bonuses.back());
-                    _entity_view_creator->createEntitySpriteView(_bonuses.back(), 4);
-                } else if (equal_rand_choice <= 0.666f) {
-                    _bonuses.push_back(std::make_shared<HPBonus>(
-                            HPBonus({0, 0}, _camera, {0.2f, 0.2f}, _animation_players["heart"])));
-                    _physics_entities.push_back(_bonuses.back());
-                    _entity_view_creator->createEntitySpriteView(_bonuses.back(), 4);
-                } else if (equal_rand_choice <= 1.f) {
-                    std::shared_ptr<Enemy> enemy = std::make_shared<Enemy>(
-                            Enemy({0, 0}, _camera, {0.2f, 0.2f}, _animation_players["skeleton"]));
-                    _physics_entities.push_back(enemy);
-                    _bonuses.push_back(enemy);
-                    _enemies.push_back(enemy);
-                    _entity_view_creator->createEntitySpriteView(_bonuses.back(), 4);
-                }
-            } else if (bonus_type <= 1.f) {
-                _bonuses.push_back(std::make_shared<AdvancedEnemy>(
-                        AdvancedEnemy({0, 0}, _camera, {0.2f, 0.2f}, _animation_players["skeleton_red"])));
-                _physics_entities.push_back(_bonuses.back());
-                _entity_view_creator->createEntitySpriteView(_bonuses.back(), 4);
-
-
-
-                std::shared_ptr<Enemy> enemy = std::make_shared<AdvancedEnemy>(
-                        AdvancedEnemy({0, 0}, _camera, {0.2f, 0.26f}, _animation_players["skeleton_red"]));
-                _physics_entities.push_back(enemy);
-                _bonuses.push_back(enemy);
-                _enemies.push_back(enemy);
-                _entity_view_creator->createEntitySpriteView(_bonuses.back(), 4);
-
-                std::shared_ptr<HPBar> hp_bar = createHPBar(enemy, false, constants::hpbarhearts::entity_ui_size,
-                                                            {0, (enemy->getViewSize().y / 2) +
-                                                                (constants::hpbarhearts::entity_ui_size.y / 2)});
-                enemy->setHPBar(hp_bar);
-                _ui_entities.push_back(hp_bar);
-            }
+        const PlatformSpawn &platform_spawn = _level_chunk.platforms[_level_chunk_index++];
+        _last_platform_y_pos = platform_spawn.position.y;
 
-            // add bonus
-            _platforms.back()->addBonus(_bonuses.back());
-            _bonuses.back()->addObserver(_score);
-        }
+        spawnPlatform(platform_spawn);
     }
 }
 
@@ -886,19 +1234,133 @@ void World::doodleModeDestroyPhysicsEntities() {
 
 void World::spawnPlayer(const Vector2f &spawn) {
     _player = std::make_shared<Doodle>(
-            Doodle(spawn, _camera, constants::player::view_size, _input_map, _animation_players["adventurer"],
-                   _audio_player));
+            Doodle(spawn, _camera, constants::player::view_size, _input_map,
+                   getAnimationPlayer(TextureGroup::adventurer), AudioPlayer(_sound_bank)));
     _physics_entities.push_back(_player);
     _entity_view_creator->createEntitySpriteView(_player, 5);
-//    _entity_audio_creator->createEntityAudio(_player);
+//    createEntityAudio(_player);
 
     // HP
-    std::shared_ptr<HPBar> hp_bar = createHPBar(_player, true, constants::hpbarhearts::screen_ui_size);
+    std::shared_ptr<HPBar> hp_bar = createHPBar(_player, constants::hpbarhearts::screen_ui_size);
     hp_bar->setPosition({-(_ingame_ui_tree->getViewSize().x / 2) + (hp_bar->getViewSize().x / 2),
                          -(_ingame_ui_tree->getViewSize().y / 2) + (hp_bar->getViewSize().y / 2)});
     _ingame_ui_tree->addChild(hp_bar, _ingame_ui_tree);
 }
 
+void World::spawnPlatform(const PlatformSpawn &platform_spawn) {
+    // todo: constants
+    float platform_width = 0.4f;
+    float platform_height = 0.075f;
+    unsigned int platform_render_layer = 3;
+
+    const Vector2f &position = platform_spawn.position;
+
+    switch (platform_spawn.type) {
+        case PlatformType::static_platform:
+            _platforms.push_back(std::make_shared<Platform>(
+                    Platform(position, _camera, {platform_width, platform_height},
+                             getAnimationPlayer(TextureGroup::green))));
+            break;
+
+        case PlatformType::temporary:
+            _platforms.push_back(std::make_shared<TempPlatform>(
+                    TempPlatform(position, _camera, {platform_width, platform_height},
+                                 getAnimationPlayer(TextureGroup::white))));
+            break;
+
+        case PlatformType::horizontal_moving:
+            _platforms.push_back(std::make_shared<MovPlatform>(
+                    MovPlatform(position, _camera, {platform_width, platform_height}, true, *_random,
+                                getAnimationPlayer(TextureGroup::blue))));
+            break;
+
+        case PlatformType::vertical_moving:
+            _platforms.push_back(std::make_shared<MovPlatform>(
+                    MovPlatform(position, _camera, {platform_width, platform_height}, false, *_random,
+                                getAnimationPlayer(TextureGroup::yellow))));
+            break;
+
+        case PlatformType::horizontal_teleporting:
+            _platforms.push_back(std::make_shared<TelePlatform>(
+                    TelePlatform(position, _camera, {platform_width, platform_height}, true, _random,
+                                 getAnimationPlayer(TextureGroup::blue_redsides))));
+            break;
+
+        case PlatformType::vertical_teleporting:
+            _platforms.push_back(std::make_shared<TelePlatform>(
+                    TelePlatform(position, _camera, {platform_width, platform_height}, false, _random,
+                                 getAnimationPlayer(TextureGroup::yellow_redsides))));
+            break;
+    }
+
+    _physics_entities.push_back(_platforms.back());
+    createLazyEntitySpriteView(_platforms.back(), platform_render_layer);
+
+    // bonus
+    if (platform_spawn.bonus != BonusType::none) {
+        std::shared_ptr<Bonus> bonus = spawnBonus(platform_spawn.bonus);
+
+        _platforms.back()->addBonus(bonus, *_random);
+        bonus->addObserver(_score);
+    }
+}
+
+std::shared_ptr<Bonus> World::spawnBonus(BonusType bonus_type) {
+    unsigned int bonus_render_layer = 4;
+
+    switch (bonus_type) {
+        case BonusType::spring:
+            _bonuses.push_back(std::make_shared<SpringBonus>(
+                    SpringBonus({0, 0}, _camera, {0.2f, 0.2f}, getAnimationPlayer(TextureGroup::spring))));
+            break;
+
+        case BonusType::jetpack:
+            _bonuses.push_back(std::make_shared<JetpackBonus>(
+                    JetpackBonus({0, 0}, _camera, {0.2f, 0.2f}, getAnimationPlayer(TextureGroup::jetpack))));
+            break;
+
+        case BonusType::spikes:
+            _bonuses.push_back(std::make_shared<SpikeBonus>(
+                    SpikeBonus({0, 0}, _camera, {0.15f, 0.075f}, getAnimationPlayer(TextureGroup::spikes))));
+            break;
+
+        case BonusType::heart:
+            _bonuses.push_back(std::make_shared<HPBonus>(
+                    HPBonus({0, 0}, _camera, {0.2f, 0.2f}, getAnimationPlayer(TextureGroup::heart))));
+            break;
+
+        case BonusType::enemy: {
+            std::shared_ptr<Enemy> enemy = std::make_shared<Enemy>(
+                    Enemy({0, 0}, _camera, {0.2f, 0.2f}, getAnimationPlayer(TextureGroup::skeleton)));
+            _bonuses.push_back(enemy);
+            _enemies.push_back(enemy);
+            break;
+        }
+
+        case BonusType::advanced_enemy: {
+            std::shared_ptr<Enemy> enemy = std::make_shared<AdvancedEnemy>(
+                    AdvancedEnemy({0, 0}, _camera, {0.2f, 0.26f}, getAnimationPlayer(TextureGroup::skeleton_red)));
+            _bonuses.push_back(enemy);
+            _enemies.push_back(enemy);
+
+            std::shared_ptr<HPBar> hp_bar = createHPBar(enemy, constants::hpbarhearts::entity_ui_size,
+                                                        {0, (enemy->getViewSize().y / 2) +
+                                                            (constants::hpbarhearts::entity_ui_size.y / 2)});
+            enemy->setHPBar(hp_bar);
+            _ui_entities.push_back(hp_bar);
+            break;
+        }
+
+        case BonusType::none:
+            return nullptr;
+    }
+
+    _physics_entities.push_back(_bonuses.back());
+    createLazyEntitySpriteView(_bonuses.back(), bonus_render_layer);
+
+    return _bonuses.back();
+}
+
 void World::spawnBgTiles(float y_spawn_position, bool up) {
     unsigned int amount = 30;
     float bg_tile_size = _camera->getWidth() / static_cast<float>(amount);
@@ -915,9 +1377,9 @@ void World::spawnBgTiles(float y_spawn_position, bool up) {
         for (unsigned int i = 0; i < amount; i++) {
             _bg_tiles.push_back(std::make_shared<BgTile>(
                     BgTile({current_x_pos, _last_bg_tile_y_pos}, _camera, {bg_tile_size, bg_tile_size},
-                           _animation_players["background_tile"])));
+                           getAnimationPlayer(TextureGroup::background_tile))));
             _ui_entities.push_back(_bg_tiles.back());
-            _entity_view_creator->createEntitySpriteView(_bg_tiles.back(), 1);
+            createLazyEntitySpriteView(_bg_tiles.back(), 1);
 
             current_x_pos += bg_tile_size;
         }
@@ -926,28 +1388,27 @@ void World::spawnBgTiles(float y_spawn_position, bool up) {
 
 void World::spawnPlayerBullet(const Vector2f &position, bool up) {
     _player_bullets.push_back(
-            std::make_shared<Bullet>(Bullet(position, _camera, {0.075f, 0.075f}, up, _animation_players["bullet"])));
+            std::make_shared<Bullet>(Bullet(position, _camera, {0.075f, 0.075f}, up,
+                                            getAnimationPlayer(TextureGroup::bullet))));
     _physics_entities.push_back(_player_bullets.back());
-    _entity_view_creator->createEntitySpriteView(_player_bullets.back(), 80);
+    createLazyEntitySpriteView(_player_bullets.back(), 80);
 }
 
 void World::spawnEnemyBullet(const Vector2f &position, bool up) {
     _enemy_bullets.push_back(
-            std::make_shared<Bullet>(Bullet(position, _camera, {0.075f, 0.075f}, up, _animation_players["bullet"])));
+            std::make_shared<Bullet>(Bullet(position, _camera, {0.075f, 0.075f}, up,
+                                            getAnimationPlayer(TextureGroup::bullet))));
     _physics_entities.push_back(_enemy_bullets.back());
-    _entity_view_creator->createEntitySpriteView(_enemy_bullets.back(), 80);
+    createLazyEntitySpriteView(_enemy_bullets.back(), 80);
 }
 
-std::shared_ptr<HPBar> World::createHPBar(const std::weak_ptr<PhysicsEntity> &entity, bool left_alligned,
-                                          const Vector2f &heart_size, const Vector2f &offset) {
+std::shared_ptr<HPBar> World::createHPBar(const std::shared_ptr<PhysicsEntity> &entity, const Vector2f &heart_size,
+                                          const Vector2f &offset) {
     std::shared_ptr<HPBar> hp_bar = std::make_shared<HPBar>(
-            HPBar({0, 0}, _camera, {0, 0}, _animation_players["heart"]));
-
-    hp_bar->setHearts(entity, hp_bar, left_alligned, heart_size, offset);
+            HPBar(entity->getPosition() + offset, _camera, {0, 0}, getAnimationPlayer(TextureGroup::heart)));
 
-    for (const auto &heart: hp_bar->getHearts()) {
-        _entity_view_creator->createEntitySpriteView(heart, 200);
-    }
+    hp_bar->setAffectedEntity(entity, heart_size);
+    _entity_view_creator->createEntityHPBarView(hp_bar, 200);
 
     return hp_bar;
 }
@@ -13,6 +13,9 @@
 #include "physics/Ray.h"
 #include "physics/collisions.h"
 
+#include "level/LevelGenerator.h"
+#include "level/StressConfig.h"
+
 #include "entities/IEntityViewCreator.h"
 #include "entities/physics/Doodle.h"
 #include "entities/physics/Wall.h"
@@ -39,9 +42,27 @@
 #include "constants/resources.h"
 #include "animation/Animation.h"
 #include "audio/IEntityAudioCreator.h"
+#include "audio/SpatialAudio.h"
+#include "effects/ParticleSystem.h"
+#include "profiling/Profiler.h"
+#include "profiling/Census.h"
 
 class World {
 private:
+    // sprite view that only exists while its entity is near the camera
+    struct LazyView {
+        std::weak_ptr<Entity> entity;
+        unsigned int layer;
+        std::weak_ptr<IObserver> view;
+    };
+
+    // every world has its own clock and random generator so worlds can run side by side
+    std::shared_ptr<Stopwatch> _stopwatch;
+    std::shared_ptr<Random> _random;
+    Profiler _profiler;
+    Census _census;
+    float _census_time_passed;
+
     std::shared_ptr<Camera> _camera;
     std::shared_ptr<InputMap> _input_map;
     std::shared_ptr<Score> _score;
@@ -50,8 +71,14 @@ private:
     std::shared_ptr<bool> _start_main_menu;
     std::shared_ptr<bool> _start_debug_mode;
     bool _debug_mode;
+    StressConfig _stress_config;
+    float _stress_fire_time_passed;
     std::shared_ptr<bool> _start_doodle_mode;
     bool _doodle_mode;
+    // steers the player of the doodle mode, for headless runs that have to climb
+    bool _autopilot;
+    bool _autopilot_rising;
+    Vector2f _autopilot_target;
     std::shared_ptr<bool> _start_pauze_overlay;
     bool _pauze_overlay;
     std::shared_ptr<bool> _resume;
@@ -68,6 +95,9 @@ private:
     std::vector<std::shared_ptr<Wall>> _walls;
     std::vector<std::shared_ptr<Platform>> _platforms;
     float _last_platform_y_pos;
+    LevelGenerator _level_generator;
+    LevelChunk _level_chunk;
+    unsigned int _level_chunk_index;
     std::vector<std::shared_ptr<Bonus>> _bonuses;
     std::shared_ptr<Bonus> _active_bonus;
     std::vector<std::weak_ptr<Enemy>> _enemies;
@@ -84,22 +114,26 @@ private:
     std::weak_ptr<TextBox> _score_text_box;
     std::vector<std::weak_ptr<Button>> _buttons;
     std::vector<std::shared_ptr<HPBar>> _enemy_hp_bars;
+    std::vector<LazyView> _lazy_views;
+    std::shared_ptr<ParticleSystem> _particle_system;
 
     // resource players
-    std::map<std::string, AnimationPlayer> _animation_players;
-    AudioPlayer _audio_player;
+    std::array<AnimationPlayer, idCount<TextureGroup>()> _animation_players;
+    std::shared_ptr<const SoundBank> _sound_bank;
 
     // audio
     std::shared_ptr<IEntityAudioCreator> _entity_audio_creator;
-    std::shared_ptr<Vector2f> _audio_listener_position;
+    SpatialAudio _spatial_audio;
 
 public:
     World(float x_min, float x_max, float y_min, float y_max, std::shared_ptr<IEntityViewCreator> entity_view_creator,
-          std::shared_ptr<IEntityAudioCreator> entity_audio_creator);
+          std::shared_ptr<IEntityAudioCreator> entity_audio_creator,
+          std::shared_ptr<Stopwatch> stopwatch = std::make_shared<Stopwatch>(),
+          std::shared_ptr<Random> random = std::make_shared<Random>());
 
     ~World();
 
-    static void sleep();
+    void sleep();
 
     void update();
 
@@ -109,6 +143,45 @@ public:
 
     std::shared_ptr<InputMap> getUserInputMap();
 
+    std::shared_ptr<Camera> getCamera() const;
+
+    const std::shared_ptr<Stopwatch> &getStopwatch() const;
+
+    const std::shared_ptr<Random> &getRandom() const;
+
+    // phase timings and allocations of the last update
+    const Profiler &getProfiler() const;
+
+    // live entities, views and observers, sampled every census sample interval
+    const Census &getCensus() const;
+
+    // takes a census sample right away
+    void updateCensus();
+
+    unsigned int getScore() const;
+
+    bool isGameOver() const;
+
+    // headless control, the mode is started on the next update
+    void requestDebugMode();
+
+    void requestDoodleMode(bool autopilot = false);
+
+    // debug mode with the extra entities of the stress config
+    void requestStressMode(const StressConfig &stress_config);
+
+    // spawns platforms of random types at random positions inside the camera view
+    void spawnRandomPlatforms(unsigned int amount);
+
+    unsigned int getPhysicsEntityCount() const;
+
+    // particle effects
+    void spawnBulletImpact(const Vector2f &position);
+
+    void spawnEnemyDeath(const Vector2f &position);
+
+    void spawnJetpackTrail(const Vector2f &position);
+
 private:
     void loadResources();
 
@@ -118,6 +191,22 @@ private:
 
     void loadAudio();
 
+    void loadParticleEffects();
+
+    const AnimationPlayer &getAnimationPlayer(TextureGroup texture_group) const;
+
+    // attaches an entity audio and registers the entity for distance attenuation
+    void createEntityAudio(const std::shared_ptr<Entity> &entity);
+
+    // the sprite view is created once the entity comes near the camera and released when it leaves
+    void createLazyEntitySpriteView(const std::shared_ptr<Entity> &entity, unsigned int layer);
+
+    bool isInViewMargin(const Entity &entity, float margin) const;
+
+    void updateLazyViews();
+
+    void registerCensusTypes();
+
     void initializeSideBars();
 
     void updateSidebars();
@@ -133,6 +222,8 @@ private:
 
     void updatePhysicsEntities(double t, float dt);
 
+    void updateParticles(float dt);
+
     void updatePhysicsCollisions();
 
     void handleUpdatePhysicsSpeed();
@@ -156,11 +247,20 @@ private:
 
     void updateDebugMode(double t, float dt);
 
+    void spawnStressScene();
+
+    void updateStressScene(float dt);
+
+    // bullets are destroyed once they leave the activity area
+    void destroyOutOfRangeBullets();
+
     // doodle mode
     void startDoodleMode();
 
     void updateDoodleMode(double t, float dt);
 
+    void updateAutopilot();
+
     void doodleModeSpawnPlatformsAndBonuses();
 
     void doodleModeDestroyPhysicsEntities();
@@ -168,14 +268,18 @@ private:
     // create / destroy entities
     void spawnPlayer(const Vector2f &spawn = constants::player::spawn_position);
 
+    void spawnPlatform(const PlatformSpawn &platform_spawn);
+
+    std::shared_ptr<Bonus> spawnBonus(BonusType bonus_type);
+
     void spawnBgTiles(float y_spawn_position, bool up);
 
     void spawnPlayerBullet(const Vector2f &position, bool up);
 
     void spawnEnemyBullet(const Vector2f &position, bool up);
 
-    std::shared_ptr<HPBar> createHPBar(const std::weak_ptr<PhysicsEntity> &entity, bool left_alligned,
-                                       const Vector2f &heart_size, const Vector2f &offset = {0, 0});
+    std::shared_ptr<HPBar> createHPBar(const std::shared_ptr<PhysicsEntity> &entity, const Vector2f &heart_size,
+                                       const Vector2f &offset = {0, 0});
 
     std::shared_ptr<UIEntity> craeteEmptyScreenUI();
 };
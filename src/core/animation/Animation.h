@@ -3,25 +3,25 @@
 
 
 #include <vector>
-#include <utility>
-#include <string>
+#include <span>
+#include <string_view>
+#include "../constants/resource_ids.h"
+
+struct TextureResource {
+    TextureGroup id;
+    std::string_view filename;
+};
 
 struct AnimationResource {
-    std::vector<std::string> texture_filenames;
+    AnimationId id;
+    std::span<const std::string_view> texture_filenames;
     float framerate;
     bool loop;
+};
 
-    AnimationResource(const std::string &texture_filename) {
-        texture_filenames = {texture_filename};
-        framerate = 0.f;
-        loop = true;
-    };
-
-    AnimationResource(const std::vector<std::string> &_texture_filenames, float _framerate, bool _loop) {
-        texture_filenames = _texture_filenames;
-        framerate = _framerate;
-        loop = _loop;
-    };
+struct AnimationGroupResource {
+    TextureGroup id;
+    std::span<const AnimationResource> animations;
 };
 
 struct Animation {
@@ -2,26 +2,33 @@
 
 #include <utility>
 
-AnimationPlayer::AnimationPlayer(std::string name, std::shared_ptr<std::map<std::string, Animation>> animations)
-        : _name(std::move(name)), _animations(std::move(animations)), _horizontal_mirror(false),
-          _current_animation_name(""), _current_animation_frame(0), _current_animation_time(0) {
+AnimationPlayer::AnimationPlayer(TextureGroup texture_group, std::shared_ptr<AnimationSet> animations)
+        : _texture_group(texture_group), _animations(std::move(animations)), _horizontal_mirror(false),
+          _current_animation_id(AnimationId::none), _current_animation(nullptr), _current_animation_frame(0),
+          _current_animation_time(0) {
 
 }
 
-const std::string &AnimationPlayer::getName() const {
-    return _name;
+TextureGroup AnimationPlayer::getTextureGroup() const {
+    return _texture_group;
 }
 
-const std::shared_ptr<std::map<std::string, Animation>> &AnimationPlayer::getAnimations() const {
+const std::shared_ptr<AnimationSet> &AnimationPlayer::getAnimations() const {
     return _animations;
 }
 
-void AnimationPlayer::setAnimations(const std::shared_ptr<std::map<std::string, Animation>> &animations) {
+void AnimationPlayer::setAnimations(const std::shared_ptr<AnimationSet> &animations) {
     _animations = animations;
+
+    // the cached animation belongs to the old set
+    _current_animation_id = AnimationId::none;
+    _current_animation = nullptr;
 }
 
-void AnimationPlayer::addAnimation(const std::string &animation_name, const Animation &animation) {
-    _animations->insert({animation_name, animation});
+void AnimationPlayer::addAnimation(AnimationId animation_id, const Animation &animation) {
+    if (!_animations) _animations = std::make_shared<AnimationSet>();
+
+    (*_animations)[toIndex(animation_id)] = animation;
 }
 
 bool AnimationPlayer::isHorizontalMirror() const {
@@ -32,37 +39,46 @@ void AnimationPlayer::setHorizontalMirror(bool horizontal_mirror) {
     _horizontal_mirror = horizontal_mirror;
 }
 
-const std::string &AnimationPlayer::getCurrentAnimationName() const {
-    return _current_animation_name;
+AnimationId AnimationPlayer::getCurrentAnimation() const {
+    return _current_animation_id;
 }
 
 unsigned int AnimationPlayer::getCurrentTextureIndex() const {
-    if (_current_animation_name.empty()) return 0;
+    if (!_current_animation) return 0;
 
-    std::vector<unsigned int> texture_indeces = _animations->at(_current_animation_name).texture_indeces;
-    return texture_indeces[_current_animation_frame];
+    return _current_animation->texture_indeces[_current_animation_frame];
 }
 
-void AnimationPlayer::startAnimation(const std::string &animation_name) {
-    _current_animation_name = animation_name;
+void AnimationPlayer::startAnimation(AnimationId animation_id) {
+    _current_animation_id = animation_id;
     _current_animation_frame = 0;
     _current_animation_time = 0;
+
+    _current_animation = nullptr;
+    if (_animations && animation_id != AnimationId::none &&
+        !(*_animations)[toIndex(animation_id)].texture_indeces.empty()) {
+        _current_animation = &(*_animations)[toIndex(animation_id)];
+    }
+}
+
+bool AnimationPlayer::isAnimating() const {
+    return _current_animation && _current_animation->texture_indeces.size() > 1;
 }
 
 bool AnimationPlayer::advanceAnimation() {
-    if (_current_animation_name.empty()) {
+    if (!_current_animation) {
         return false;
     }
 
-    float framerate = _animations->at(_current_animation_name).framerate;
+    float framerate = _current_animation->framerate;
     _current_animation_time += framerate;
 
     if (_current_animation_time >= 1 || framerate == 0) {
-        if (_current_animation_frame + 1 < _animations->at(_current_animation_name).texture_indeces.size()) {
+        if (_current_animation_frame + 1 < _current_animation->texture_indeces.size()) {
             _current_animation_frame += 1;
             _current_animation_time -= 1;
             return true;
-        } else if (_animations->at(_current_animation_name).loop) {
+        } else if (_current_animation->loop) {
             _current_animation_frame = 0;
             _current_animation_time -= 1;
             return true;
@@ -2,46 +2,53 @@
 #define GAMEENGINE_ANIMATIONPLAYER_H
 
 
-#include <string>
-#include <map>
+#include <array>
 #include <memory>
 #include <utility>
 #include "Animation.h"
+#include "../constants/resource_ids.h"
+
+// animations of a texture group, indexed by animation id
+using AnimationSet = std::array<Animation, idCount<AnimationId>()>;
 
 class AnimationPlayer {
 private:
-    std::string _name;
-    std::shared_ptr<std::map<std::string, Animation>> _animations;
+    TextureGroup _texture_group;
+    std::shared_ptr<AnimationSet> _animations;
     bool _horizontal_mirror;
 
-    std::string _current_animation_name;
+    AnimationId _current_animation_id;
+    // points into the shared animation set, nullptr if no animation is playing
+    const Animation *_current_animation;
     unsigned int _current_animation_frame;
     float _current_animation_time;
 
 public:
-    AnimationPlayer(std::string name = "",
-                    std::shared_ptr<std::map<std::string, Animation>> animations =
-                    std::make_shared<std::map<std::string, Animation>>());
+    AnimationPlayer(TextureGroup texture_group = TextureGroup::none,
+                    std::shared_ptr<AnimationSet> animations = nullptr);
 
-    const std::string &getName() const;
+    TextureGroup getTextureGroup() const;
 
-    const std::shared_ptr<std::map<std::string, Animation>> &getAnimations() const;
+    const std::shared_ptr<AnimationSet> &getAnimations() const;
 
-    void setAnimations(const std::shared_ptr<std::map<std::string, Animation>> &animations);
+    void setAnimations(const std::shared_ptr<AnimationSet> &animations);
 
-    void addAnimation(const std::string &animation_name, const Animation &animation);
+    void addAnimation(AnimationId animation_id, const Animation &animation);
 
     bool isHorizontalMirror() const;
 
     void setHorizontalMirror(bool horizontal_mirror);
 
-    const std::string &getCurrentAnimationName() const;
+    AnimationId getCurrentAnimation() const;
 
     unsigned int getCurrentTextureIndex() const;
 
-    void startAnimation(const std::string &animation_name);
+    void startAnimation(AnimationId animation_id);
 
     bool advanceAnimation();
+
+    // playing an animation with more than one frame
+    bool isAnimating() const;
 };
 
 
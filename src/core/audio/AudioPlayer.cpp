@@ -1,40 +1,42 @@
-#include <memory>
 #include "AudioPlayer.h"
 
-AudioPlayer::AudioPlayer() : _current_volume(100), _max_distance(1) {
+AudioPlayer::AudioPlayer() : _current_sound(-1), _current_music(-1), _current_volume(100) {
 
 }
 
-void AudioPlayer::addSound(unsigned int sound_id, const std::string &sound_name) {
-    _sound_ids[sound_name] = sound_id;
-}
+AudioPlayer::AudioPlayer(std::shared_ptr<const SoundBank> sound_bank)
+        : _sound_bank(std::move(sound_bank)), _current_sound(-1), _current_music(-1), _current_volume(100) {
 
-void AudioPlayer::addMusic(unsigned int music_id, const std::string &music_name) {
-    _music_ids[music_name] = music_id;
 }
 
-unsigned int AudioPlayer::getSoundId(const std::string &sound_name) {
-    // todo exception handling
+int AudioPlayer::getSoundId(SoundId sound) const {
+    if (!_sound_bank) return -1;
 
-    _current_sound = sound_name;
-    return _sound_ids.at(sound_name);
+    return _sound_bank->getSoundId(sound);
 }
 
-unsigned int AudioPlayer::getMusicId(const std::string &music_name) {
-    // todo exception handling
+int AudioPlayer::getMusicId(MusicId music) const {
+    if (!_sound_bank) return -1;
 
-    _current_music = music_name;
-    return _music_ids.at(music_name);
+    return _sound_bank->getMusicId(music);
 }
 
-const std::string &AudioPlayer::getCurrentSound() const {
+int AudioPlayer::getCurrentSound() const {
     return _current_sound;
 }
 
-const std::string &AudioPlayer::getCurrentMusic() const {
+void AudioPlayer::setCurrentSound(int current_sound) {
+    _current_sound = current_sound;
+}
+
+int AudioPlayer::getCurrentMusic() const {
     return _current_music;
 }
 
+void AudioPlayer::setCurrentMusic(int current_music) {
+    _current_music = current_music;
+}
+
 unsigned int AudioPlayer::getCurrentVolume() const {
     return _current_volume;
 }
@@ -42,19 +44,3 @@ unsigned int AudioPlayer::getCurrentVolume() const {
 void AudioPlayer::setCurrentVolume(unsigned int currentVolume) {
     _current_volume = currentVolume;
 }
-
-const std::shared_ptr<Vector2f> &AudioPlayer::getAudioListenerPosition() const {
-    return _audio_listener_position;
-}
-
-void AudioPlayer::setAudioListenerPosition(const std::shared_ptr<Vector2f> &audio_listener_position) {
-    _audio_listener_position = audio_listener_position;
-}
-
-float AudioPlayer::getMaxDistance() const {
-    return _max_distance;
-}
-
-void AudioPlayer::setMaxDistance(float max_distance) {
-    _max_distance = max_distance;
-}
@@ -2,48 +2,40 @@
 #define GAMEENGINE_AUDIOPLAYER_H
 
 
-#include <map>
-#include <string>
-#include "../math/Vector2f.h"
+#include <memory>
+#include "SoundBank.h"
 
+// per entity audio state, the sound tables live in the shared sound bank
 class AudioPlayer {
 private:
-    std::map<std::string, unsigned int> _sound_ids;
-    std::map<std::string, unsigned int> _music_ids;
+    std::shared_ptr<const SoundBank> _sound_bank;
 
-    std::string _current_sound;
-    std::string _current_music;
+    int _current_sound;
+    int _current_music;
 
     unsigned int _current_volume;
-    std::shared_ptr<Vector2f> _audio_listener_position;
-    float _max_distance;
 
 public:
     AudioPlayer();
 
-    void addSound(unsigned int sound_id, const std::string &sound_name);
+    explicit AudioPlayer(std::shared_ptr<const SoundBank> sound_bank);
 
-    void addMusic(unsigned int music_id, const std::string &music_name);
+    // handle lookups, not meant for the play path
+    int getSoundId(SoundId sound) const;
 
-    unsigned int getSoundId(const std::string &sound_name);
+    int getMusicId(MusicId music) const;
 
-    unsigned int getMusicId(const std::string &music_name);
+    int getCurrentSound() const;
 
-    const std::string &getCurrentSound() const;
+    void setCurrentSound(int current_sound);
 
-    const std::string &getCurrentMusic() const;
+    int getCurrentMusic() const;
+
+    void setCurrentMusic(int current_music);
 
     unsigned int getCurrentVolume() const;
 
     void setCurrentVolume(unsigned int currentVolume);
-
-    const std::shared_ptr<Vector2f> &getAudioListenerPosition() const;
-
-    void setAudioListenerPosition(const std::shared_ptr<Vector2f> &audio_listener_position);
-
-    float getMaxDistance() const;
-
-    void setMaxDistance(float max_distance);
 };
 
 
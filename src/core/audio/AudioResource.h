@@ -1,10 +1,21 @@
 #ifndef GAMEENGINE_AUDIORESOURCE_H
 #define GAMEENGINE_AUDIORESOURCE_H
 
+#include <string_view>
+#include "../constants/resource_ids.h"
+
 struct AudioResource {
-    std::string filename;
+    SoundId id;
+    std::string_view filename;
     bool loop;
     bool finish;
+    // voice stealing priority, higher priority sounds can take the voice of lower ones
+    unsigned int priority;
+};
+
+struct MusicResource {
+    MusicId id;
+    std::string_view filename;
 };
 
 #endif //GAMEENGINE_AUDIORESOURCE_H
@@ -10,7 +10,10 @@ class IEntityAudioCreator {
 private:
 
 public:
-    virtual unsigned int loadSound(const std::string &filename) = 0;
+    virtual unsigned int loadSound(const std::string &filename, unsigned int priority) = 0;
+
+    // fire and forget sound that isn't bound to an entity
+    virtual void playSound(unsigned int sound_id, unsigned int volume) = 0;
 
     virtual unsigned int loadMusic(const std::string &filename) = 0;
 
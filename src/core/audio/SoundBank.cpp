@@ -0,0 +1,22 @@
+#include "SoundBank.h"
+
+SoundBank::SoundBank() {
+    _sound_ids.fill(-1);
+    _music_ids.fill(-1);
+}
+
+void SoundBank::addSound(unsigned int sound_id, SoundId sound) {
+    _sound_ids[toIndex(sound)] = static_cast<int>(sound_id);
+}
+
+void SoundBank::addMusic(unsigned int music_id, MusicId music) {
+    _music_ids[toIndex(music)] = static_cast<int>(music_id);
+}
+
+int SoundBank::getSoundId(SoundId sound) const {
+    return _sound_ids[toIndex(sound)];
+}
+
+int SoundBank::getMusicId(MusicId music) const {
+    return _music_ids[toIndex(music)];
+}
@@ -0,0 +1,29 @@
+#ifndef GAMEENGINE_SOUNDBANK_H
+#define GAMEENGINE_SOUNDBANK_H
+
+
+#include <array>
+#include "../constants/resource_ids.h"
+
+// registry id to loaded id tables of the sounds and music, built once by the world and shared read-only by every
+// entity
+class SoundBank {
+private:
+    std::array<int, idCount<SoundId>()> _sound_ids;
+    std::array<int, idCount<MusicId>()> _music_ids;
+
+public:
+    SoundBank();
+
+    void addSound(unsigned int sound_id, SoundId sound);
+
+    void addMusic(unsigned int music_id, MusicId music);
+
+    // returns -1 for resources that aren't loaded
+    int getSoundId(SoundId sound) const;
+
+    int getMusicId(MusicId music) const;
+};
+
+
+#endif //GAMEENGINE_SOUNDBANK_H
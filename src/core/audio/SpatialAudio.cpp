@@ -0,0 +1,72 @@
+#include "SpatialAudio.h"
+
+#include <limits>
+#include "../entities/Entity.h"
+
+SpatialAudio::SpatialAudio(float max_distance, unsigned int volume_step)
+        : _listener_position(0, 0), _max_distance(max_distance), _volume_step(volume_step > 0 ? volume_step : 1) {
+
+}
+
+void SpatialAudio::addEntity(const std::shared_ptr<Entity> &entity) {
+    _entities.push_back(entity);
+    // forces a volume push on the next update
+    _volumes.push_back(std::numeric_limits<unsigned int>::max());
+}
+
+void SpatialAudio::setListenerPosition(const Vector2f &listener_position) {
+    _listener_position = listener_position;
+}
+
+void SpatialAudio::update() {
+    removeExpiredEntities();
+
+    _positions.clear();
+    for (const auto &entity: _entities) {
+        _positions.push_back(entity.lock()->getPosition());
+    }
+
+    // volume falls off with the squared distance, no square roots needed
+    float max_distance_squared = _max_distance * _max_distance;
+    _distances_squared.resize(_positions.size());
+    vector2f::distancesSquared(_positions, _listener_position, _distances_squared);
+
+    _new_volumes.resize(_positions.size());
+    for (unsigned int i = 0; i < _positions.size(); i++) {
+        unsigned int volume = 0;
+        if (_distances_squared[i] < max_distance_squared) {
+            volume = static_cast<unsigned int>((1 - _distances_squared[i] / max_distance_squared) * 100);
+            volume -= volume % _volume_step;
+        }
+        _new_volumes[i] = volume;
+    }
+
+    for (unsigned int i = 0; i < _new_volumes.size(); i++) {
+        if (_new_volumes[i] == _volumes[i]) continue;
+
+        _volumes[i] = _new_volumes[i];
+        _entities[i].lock()->setAudioVolume(_new_volumes[i]);
+    }
+}
+
+void SpatialAudio::clear() {
+    _entities.clear();
+    _volumes.clear();
+}
+
+unsigned int SpatialAudio::size() const {
+    return _entities.size();
+}
+
+void SpatialAudio::removeExpiredEntities() {
+    unsigned int j = 0;
+    for (unsigned int i = 0; i < _entities.size(); i++) {
+        if (_entities[i].expired()) continue;
+
+        _entities[j] = _entities[i];
+        _volumes[j] = _volumes[i];
+        j++;
+    }
+    _entities.resize(j);
+    _volumes.resize(j);
+}
@@ -0,0 +1,45 @@
+#ifndef GAMEENGINE_SPATIALAUDIO_H
+#define GAMEENGINE_SPATIALAUDIO_H
+
+
+#include <memory>
+#include <vector>
+#include "../math/Vector2f.h"
+
+class Entity;
+
+// distance attenuation for the entities that have an entity audio attached, every other entity pays nothing
+class SpatialAudio {
+private:
+    std::vector<std::weak_ptr<Entity>> _entities;
+    // last volume pushed to each entity
+    std::vector<unsigned int> _volumes;
+
+    // batch buffers
+    std::vector<Vector2f> _positions;
+    std::vector<float> _distances_squared;
+    std::vector<unsigned int> _new_volumes;
+
+    Vector2f _listener_position;
+    float _max_distance;
+    unsigned int _volume_step;
+
+public:
+    SpatialAudio(float max_distance, unsigned int volume_step);
+
+    void addEntity(const std::shared_ptr<Entity> &entity);
+
+    void setListenerPosition(const Vector2f &listener_position);
+
+    void update();
+
+    void clear();
+
+    unsigned int size() const;
+
+private:
+    void removeExpiredEntities();
+};
+
+
+#endif //GAMEENGINE_SPATIALAUDIO_H
@@ -8,6 +8,7 @@ namespace constants {
     const float camera_view_x_max = 1;
     const float camera_view_y_min = 0.f;
     const float camera_view_y_max = 3.f;
+    const float camera_score_per_unit = 50.f;
 
     const Vector2f aspect_ratio = {2, 3};
 
@@ -40,6 +41,49 @@ namespace constants {
         const float time_delay = 0.4f;
     }
 
+    namespace physics {
+        const float activity_margin = 0.5f;
+    }
+
+    namespace view {
+        const float create_margin = 0.25f;
+        const float release_margin = 0.5f;
+    }
+
+    namespace particles {
+        const unsigned int capacity = 4096;
+
+        const unsigned int impact_count = 6;
+        const float impact_speed = 0.3f;
+        const float impact_size = 0.08f;
+        const float impact_lifetime = 0.25f;
+
+        const float death_explosion_size = 0.35f;
+        const float death_explosion_lifetime = 0.6f;
+        const unsigned int death_count = 12;
+        const float death_speed = 0.5f;
+        const float death_size = 0.1f;
+        const float death_lifetime = 0.5f;
+
+        const float trail_drift = 0.05f;
+        const float trail_speed = 0.5f;
+        const float trail_size = 0.06f;
+        const float trail_lifetime = 0.35f;
+    }
+
+    namespace census {
+        const float sample_interval = 1.f;
+    }
+
+    namespace turbo {
+        const unsigned int ticks_per_frame = 16;
+    }
+
+    namespace audio {
+        const float max_distance = 2.f;
+        const unsigned int volume_step = 5;
+    }
+
     namespace hpbarhearts {
         const float horizontal_distance_multiplier = 0.2f;
         const Vector2f screen_ui_size = {0.2f, 0.2f};
@@ -14,6 +14,8 @@ namespace constants {
     extern const float camera_view_x_max;
     extern const float camera_view_y_min;
     extern const float camera_view_y_max;
+    // score per world unit the camera moves
+    extern const float camera_score_per_unit;
 
     extern const Vector2f aspect_ratio;
 
@@ -46,6 +48,58 @@ namespace constants {
         extern const float time_delay;
     }
 
+    namespace physics {
+        // physics entities further than this outside the camera bounds are put to sleep
+        extern const float activity_margin;
+    }
+
+    namespace view {
+        // lazy entity views are created within this margin around the camera bounds and released outside of the
+        // larger release margin, the gap keeps views from being rebuilt at the edge
+        extern const float create_margin;
+        extern const float release_margin;
+    }
+
+    namespace particles {
+        extern const unsigned int capacity;
+
+        // burst where a bullet hits, speeds in world units per second and lifetimes in seconds
+        extern const unsigned int impact_count;
+        extern const float impact_speed;
+        extern const float impact_size;
+        extern const float impact_lifetime;
+
+        // explosion and burst where an enemy dies
+        extern const float death_explosion_size;
+        extern const float death_explosion_lifetime;
+        extern const unsigned int death_count;
+        extern const float death_speed;
+        extern const float death_size;
+        extern const float death_lifetime;
+
+        // particle left behind the jetpack every tick, it drifts sideways by a random speed up to trail_drift
+        extern const float trail_drift;
+        extern const float trail_speed;
+        extern const float trail_size;
+        extern const float trail_lifetime;
+    }
+
+    namespace census {
+        // seconds between census samples
+        extern const float sample_interval;
+    }
+
+    namespace turbo {
+        // physics ticks per rendered frame of the fixed turbo
+        extern const unsigned int ticks_per_frame;
+    }
+
+    namespace audio {
+        extern const float max_distance;
+        // volume changes smaller than this aren't sent to the entity audio
+        extern const unsigned int volume_step;
+    }
+
     namespace hpbarhearts {
         extern const float horizontal_distance_multiplier;
         extern const Vector2f screen_ui_size;
@@ -0,0 +1,84 @@
+#ifndef GAMEENGINE_RESOURCEIDS_H
+#define GAMEENGINE_RESOURCEIDS_H
+
+#include <cstddef>
+
+// ids of the resources in the registry (resources.h), the order has to match the registry tables
+
+// single textures first, followed by the animation groups
+enum class TextureGroup : unsigned int {
+    background,
+    background_tile,
+    menu,
+    button,
+    hamburger,
+    green,
+    blue,
+    blue_redsides,
+    yellow,
+    yellow_redsides,
+    white,
+    black,
+    wall,
+    wall2,
+    portal_radio,
+    spring,
+    jetpack,
+    spikes,
+    skeleton,
+    skeleton_red,
+    bullet,
+
+    // animation groups
+    doodle,
+    adventurer,
+    heart,
+
+    count,
+    none = count
+};
+
+enum class AnimationId : unsigned int {
+    standing,
+    jump,
+    crouch,
+    fall,
+    idle,
+    run,
+    red,
+    black,
+
+    count,
+    none = count
+};
+
+enum class ParticleEffect : unsigned int {
+    explosion,
+    circle_explosion,
+
+    count
+};
+
+enum class SoundId : unsigned int {
+    scream,
+
+    count
+};
+
+enum class MusicId : unsigned int {
+    portal_radio,
+
+    count
+};
+
+template<typename Id>
+constexpr std::size_t toIndex(Id id) {
+    return static_cast<std::size_t>(id);
+}
+
+template<typename Id>
+constexpr std::size_t idCount() {
+    return static_cast<std::size_t>(Id::count);
+}
+
+#endif //GAMEENGINE_RESOURCEIDS_H
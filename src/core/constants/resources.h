@@ -1,17 +1,192 @@
 #ifndef GAMEENGINE_ANIMATIONDATA_H
 #define GAMEENGINE_ANIMATIONDATA_H
 
-#include <map>
-#include <string>
+#include <array>
+#include <span>
+#include <string_view>
+#include "resource_ids.h"
 #include "../animation/Animation.h"
 #include "../audio/AudioResource.h"
+#include "../effects/ParticleEffectResource.h"
 
-extern const std::map<std::string, std::string> texture_data;
+// compile time resource registry, every table is indexed by its id enum (checked below)
 
-extern const std::map<std::string, std::map<std::string, AnimationResource>> animation_groups_data;
+inline constexpr std::array<TextureResource, 21> texture_data = {{
+        {TextureGroup::background,      "data/textures/prototype/Dark/texture_07.png"},
+        {TextureGroup::background_tile, "data/sprites/background_tile/background_tile.png"},
+        {TextureGroup::menu,            "data/ui/menu.png"},
+        {TextureGroup::button,          "data/ui/button.png"},
+        {TextureGroup::hamburger,       "data/ui/hamburger.png"},
+        {TextureGroup::green,           "data/textures/colors/green.png"},
+        {TextureGroup::blue,            "data/textures/colors/blue.png"},
+        {TextureGroup::blue_redsides,   "data/textures/colors/blue_redsides.png"},
+        {TextureGroup::yellow,          "data/textures/colors/yellow.png"},
+        {TextureGroup::yellow_redsides, "data/textures/colors/yellow_redsides.png"},
+        {TextureGroup::white,           "data/textures/colors/white.png"},
+        {TextureGroup::black,           "data/textures/colors/black.png"},
+        {TextureGroup::wall,            "data/textures/cobble_stone.png"},
+        {TextureGroup::wall2,           "data/textures/prototype/Red/texture_03.png"},
+        {TextureGroup::portal_radio,    "data/sprites/portal/portal_radio.png"},
+        {TextureGroup::spring,          "data/sprites/bonus/spring.png"},
+        {TextureGroup::jetpack,         "data/sprites/bonus/raketa_on_panel.png"},
+        {TextureGroup::spikes,          "data/sprites/spikes/spikes.png"},
+        {TextureGroup::skeleton,        "data/sprites/skeleton/skeleton.png"},
+        {TextureGroup::skeleton_red,    "data/sprites/skeleton/skeleton_red.png"},
+        {TextureGroup::bullet,          "data/sprites/bullet/bullet.png"},
+}};
 
-extern const std::map<std::string, std::string> audio_sound_data;
+// animation frames
+namespace animation_frames {
+    inline constexpr std::array<std::string_view, 1> doodle_standing = {
+            "data/sprites/doodle/doodle-left.png",
+    };
+    inline constexpr std::array<std::string_view, 1> doodle_jump = {
+            "data/sprites/doodle/doodle-right.png",
+    };
 
-extern const std::map<std::string, std::string> audio_music_data;
+    inline constexpr std::array<std::string_view, 4> adventurer_crouch = {
+            "data/sprites/adventurer/adventurer-crouch-00.png",
+            "data/sprites/adventurer/adventurer-crouch-01.png",
+            "data/sprites/adventurer/adventurer-crouch-02.png",
+            "data/sprites/adventurer/adventurer-crouch-03.png",
+    };
+    inline constexpr std::array<std::string_view, 2> adventurer_fall = {
+            "data/sprites/adventurer/adventurer-fall-00.png",
+            "data/sprites/adventurer/adventurer-fall-01.png",
+    };
+    inline constexpr std::array<std::string_view, 4> adventurer_idle = {
+            "data/sprites/adventurer/adventurer-idle-00.png",
+            "data/sprites/adventurer/adventurer-idle-01.png",
+            "data/sprites/adventurer/adventurer-idle-02.png",
+            "data/sprites/adventurer/adventurer-idle-03.png",
+    };
+    inline constexpr std::array<std::string_view, 4> adventurer_jump = {
+            "data/sprites/adventurer/adventurer-jump-00.png",
+            "data/sprites/adventurer/adventurer-jump-01.png",
+            "data/sprites/adventurer/adventurer-jump-02.png",
+            "data/sprites/adventurer/adventurer-jump-03.png",
+    };
+    inline constexpr std::array<std::string_view, 6> adventurer_run = {
+            "data/sprites/adventurer/adventurer-run-00.png",
+            "data/sprites/adventurer/adventurer-run-01.png",
+            "data/sprites/adventurer/adventurer-run-02.png",
+            "data/sprites/adventurer/adventurer-run-03.png",
+            "data/sprites/adventurer/adventurer-run-04.png",
+            "data/sprites/adventurer/adventurer-run-05.png",
+    };
+
+    inline constexpr std::array<std::string_view, 1> heart_red = {
+            "data/sprites/heart/heart_red.png",
+    };
+    inline constexpr std::array<std::string_view, 1> heart_black = {
+            "data/sprites/heart/heart_black.png",
+    };
+
+    inline constexpr std::array<std::string_view, 10> explosion = {
+            "data/sprites/explosion/Explosion1.png",
+            "data/sprites/explosion/Explosion2.png",
+            "data/sprites/explosion/Explosion3.png",
+            "data/sprites/explosion/Explosion4.png",
+            "data/sprites/explosion/Explosion5.png",
+            "data/sprites/explosion/Explosion6.png",
+            "data/sprites/explosion/Explosion7.png",
+            "data/sprites/explosion/Explosion8.png",
+            "data/sprites/explosion/Explosion9.png",
+            "data/sprites/explosion/Explosion10.png",
+    };
+    inline constexpr std::array<std::string_view, 10> circle_explosion = {
+            "data/sprites/circle_explosion/Circle_explosion1.png",
+            "data/sprites/circle_explosion/Circle_explosion2.png",
+            "data/sprites/circle_explosion/Circle_explosion3.png",
+            "data/sprites/circle_explosion/Circle_explosion4.png",
+            "data/sprites/circle_explosion/Circle_explosion5.png",
+            "data/sprites/circle_explosion/Circle_explosion6.png",
+            "data/sprites/circle_explosion/Circle_explosion7.png",
+            "data/sprites/circle_explosion/Circle_explosion8.png",
+            "data/sprites/circle_explosion/Circle_explosion9.png",
+            "data/sprites/circle_explosion/Circle_explosion10.png",
+    };
+}
+
+// animations
+namespace animation_data {
+    inline constexpr std::array<AnimationResource, 2> doodle = {{
+            {AnimationId::standing, animation_frames::doodle_standing, 0.10f, true},
+            {AnimationId::jump,     animation_frames::doodle_jump,     0.10f, false},
+    }};
+
+    inline constexpr std::array<AnimationResource, 5> adventurer = {{
+            {AnimationId::crouch, animation_frames::adventurer_crouch, 0.10f, true},
+            {AnimationId::fall,   animation_frames::adventurer_fall,   0.10f, true},
+            {AnimationId::idle,   animation_frames::adventurer_idle,   0.10f, true},
+            {AnimationId::jump,   animation_frames::adventurer_jump,   0.15f, false},
+            {AnimationId::run,    animation_frames::adventurer_run,    0.10f, true},
+    }};
+
+    inline constexpr std::array<AnimationResource, 2> heart = {{
+            {AnimationId::red,   animation_frames::heart_red,   0.f, true},
+            {AnimationId::black, animation_frames::heart_black, 0.f, true},
+    }};
+}
+
+inline constexpr std::array<AnimationGroupResource, 3> animation_groups_data = {{
+        {TextureGroup::doodle,     animation_data::doodle},
+        {TextureGroup::adventurer, animation_data::adventurer},
+        {TextureGroup::heart,      animation_data::heart},
+}};
+
+// particle effects play their frames once over the particle lifetime
+inline constexpr std::array<ParticleEffectResource, 2> particle_effect_data = {{
+        {ParticleEffect::explosion,        animation_frames::explosion},
+        {ParticleEffect::circle_explosion, animation_frames::circle_explosion},
+}};
+
+inline constexpr std::array<AudioResource, 1> audio_sound_data = {{
+        {SoundId::scream, "data/audio/wilhelm_scream.wav", false, true, 10},
+}};
+
+inline constexpr std::array<MusicResource, 1> audio_music_data = {{
+        {MusicId::portal_radio, "data/audio/portal_radio_music.wav"},
+}};
+
+// registry checks
+namespace resource_checks {
+    template<typename Table>
+    constexpr bool isIndexedById(const Table &table, std::size_t first_index) {
+        for (std::size_t i = 0; i < table.size(); i++) {
+            if (toIndex(table[i].id) != first_index + i) return false;
+        }
+        return true;
+    }
+
+    constexpr bool hasValidAnimations(const std::span<const AnimationGroupResource> animation_groups) {
+        for (const auto &animation_group: animation_groups) {
+            for (std::size_t i = 0; i < animation_group.animations.size(); i++) {
+                const AnimationResource &animation = animation_group.animations[i];
+                if (animation.id == AnimationId::none || animation.texture_filenames.empty()) return false;
+
+                for (std::size_t j = 0; j < i; j++) {
+                    if (animation_group.animations[j].id == animation.id) return false;
+                }
+            }
+        }
+        return true;
+    }
+}
+
+static_assert(texture_data.size() + animation_groups_data.size() == idCount<TextureGroup>(),
+              "every texture group needs exactly one texture or animation group");
+static_assert(resource_checks::isIndexedById(texture_data, 0), "texture_data must follow the TextureGroup order");
+static_assert(resource_checks::isIndexedById(animation_groups_data, texture_data.size()),
+              "animation_groups_data must follow the TextureGroup order");
+static_assert(resource_checks::hasValidAnimations(animation_groups_data),
+              "animations need frames and a unique id within their group");
+static_assert(particle_effect_data.size() == idCount<ParticleEffect>() &&
+              resource_checks::isIndexedById(particle_effect_data, 0),
+              "particle_effect_data must follow the ParticleEffect order");
+static_assert(audio_sound_data.size() == idCount<SoundId>() && resource_checks::isIndexedById(audio_sound_data, 0),
+              "audio_sound_data must follow the SoundId order");
+static_assert(audio_music_data.size() == idCount<MusicId>() && resource_checks::isIndexedById(audio_music_data, 0),
+              "audio_music_data must follow the MusicId order");
 
 #endif //GAMEENGINE_ANIMATIONDATA_H
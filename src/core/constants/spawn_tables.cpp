@@ -0,0 +1,42 @@
+#include "spawn_tables.h"
+
+namespace constants {
+    namespace spawn {
+        const float bonus_chance = 0.2f;
+
+        const unsigned int difficulty_buckets = 64;
+    }
+}
+
+namespace {
+    // properties every spawn table needs, whatever its odds: ascending thresholds that end at the highest
+    // difficulty, weights that add up to 1 and bands that are split evenly
+    template<typename T, std::size_t N>
+    constexpr bool isValidSpawnTable(const std::array<constants::spawn::Threshold<T>, N> &table, float sig_val) {
+        if (table[N - 1].upper_threshold != 1.f) return false;
+
+        float total = 0;
+        for (std::size_t i = 0; i < N; i++) {
+            if (i > 0 && table[i].upper_threshold < table[i - 1].upper_threshold) return false;
+
+            float weight = constants::spawn::thresholdWeight(table, i, sig_val);
+            if (i > 0 && table[i].upper_threshold == table[i - 1].upper_threshold &&
+                weight != constants::spawn::thresholdWeight(table, i - 1, sig_val)) {
+                return false;
+            }
+            total += weight;
+        }
+        return total > 1 - 1e-5f && total < 1 + 1e-5f;
+    }
+
+    template<typename T, std::size_t N>
+    constexpr bool isValidSpawnTable(const std::array<constants::spawn::Threshold<T>, N> &table) {
+        for (float sig_val: {0.05f, 0.25f, 0.5f, 0.75f, 1.f}) {
+            if (!isValidSpawnTable(table, sig_val)) return false;
+        }
+        return true;
+    }
+}
+
+static_assert(isValidSpawnTable(constants::spawn::platform_table), "platform_table isn't a valid spawn table");
+static_assert(isValidSpawnTable(constants::spawn::bonus_table), "bonus_table isn't a valid spawn table");
@@ -0,0 +1,62 @@
+#ifndef GAMEENGINE_SPAWNTABLES_H
+#define GAMEENGINE_SPAWNTABLES_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include "../level/LevelChunk.h"
+
+namespace constants {
+    namespace spawn {
+        // a type is picked when uniform(0, difficulty) lands in (previous threshold, upper threshold],
+        // so the higher types only unlock when the sigmoid difficulty of the score gets there,
+        // consecutive entries with the same upper threshold split their band evenly
+        template<typename T>
+        struct Threshold {
+            T type;
+            float upper_threshold;
+        };
+
+        inline constexpr std::array<Threshold<PlatformType>, 6> platform_table = {{
+                {PlatformType::static_platform,        0.20f},
+                {PlatformType::temporary,              0.40f},
+                {PlatformType::horizontal_moving,      0.55f},
+                {PlatformType::vertical_moving,        0.70f},
+                {PlatformType::horizontal_teleporting, 0.85f},
+                {PlatformType::vertical_teleporting,   1.00f},
+        }};
+
+        inline constexpr std::array<Threshold<BonusType>, 6> bonus_table = {{
+                {BonusType::spring,         0.30f},
+                {BonusType::jetpack,        0.40f},
+                // spikes, hearts and enemies share the 0.40 - 0.80 band
+                {BonusType::spikes,         0.80f},
+                {BonusType::heart,          0.80f},
+                {BonusType::enemy,          0.80f},
+                {BonusType::advanced_enemy, 1.00f},
+        }};
+
+        // chance that a platform carries a bonus
+        extern const float bonus_chance;
+
+        // amount of difficulty levels the alias tables are precomputed for
+        extern const unsigned int difficulty_buckets;
+
+        // probability of a table entry when drawing uniform(0, sig_val), the part of its band above sig_val is cut off
+        template<typename T, std::size_t N>
+        constexpr float thresholdWeight(const std::array<Threshold<T>, N> &table, std::size_t index, float sig_val) {
+            float upper_threshold = table[index].upper_threshold;
+
+            std::size_t band_begin = index;
+            while (band_begin > 0 && table[band_begin - 1].upper_threshold == upper_threshold) band_begin--;
+            std::size_t band_end = index + 1;
+            while (band_end < N && table[band_end].upper_threshold == upper_threshold) band_end++;
+
+            float lower_threshold = band_begin == 0 ? 0.f : table[band_begin - 1].upper_threshold;
+            float band_weight = std::max(std::min(upper_threshold, sig_val) - lower_threshold, 0.f) / sig_val;
+            return band_weight / static_cast<float>(band_end - band_begin);
+        }
+    }
+}
+
+#endif //GAMEENGINE_SPAWNTABLES_H
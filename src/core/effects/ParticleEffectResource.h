@@ -0,0 +1,13 @@
+#ifndef GAMEENGINE_PARTICLEEFFECTRESOURCE_H
+#define GAMEENGINE_PARTICLEEFFECTRESOURCE_H
+
+#include <span>
+#include <string_view>
+#include "../constants/resource_ids.h"
+
+struct ParticleEffectResource {
+    ParticleEffect id;
+    std::span<const std::string_view> texture_filenames;
+};
+
+#endif //GAMEENGINE_PARTICLEEFFECTRESOURCE_H
@@ -0,0 +1,109 @@
+#include "ParticleSystem.h"
+
+#include <cmath>
+#include <utility>
+
+ParticleSystem::ParticleSystem(unsigned int capacity, std::shared_ptr<Random> random)
+        : _capacity(capacity), _count(0), _dropped_particles(0), _x(capacity), _y(capacity), _velocity_x(capacity),
+          _velocity_y(capacity), _size(capacity), _age(capacity), _lifetime(capacity), _effect(capacity),
+          _random(std::move(random)) {
+
+}
+
+void ParticleSystem::spawn(ParticleEffect effect, const Vector2f &position, const Vector2f &velocity, float size,
+                           float lifetime) {
+    if (_count == _capacity || lifetime <= 0) {
+        _dropped_particles++;
+        return;
+    }
+
+    _x[_count] = position.x;
+    _y[_count] = position.y;
+    _velocity_x[_count] = velocity.x;
+    _velocity_y[_count] = velocity.y;
+    _size[_count] = size;
+    _age[_count] = 0;
+    _lifetime[_count] = lifetime;
+    _effect[_count] = effect;
+    _count++;
+}
+
+void ParticleSystem::spawnBurst(ParticleEffect effect, const Vector2f &position, unsigned int amount,
+                                float max_speed, float size, float lifetime) {
+    for (unsigned int i = 0; i < amount; i++) {
+        float angle = _random->uniform_real(0, 2 * static_cast<float>(M_PI));
+        float speed = _random->uniform_real(0, max_speed);
+
+        spawn(effect, position, {std::cos(angle) * speed, std::sin(angle) * speed}, size, lifetime);
+    }
+}
+
+void ParticleSystem::update(float dt) {
+    // integrate every live particle in one pass over each array
+    for (unsigned int i = 0; i < _count; i++) {
+        _x[i] += _velocity_x[i] * dt;
+        _y[i] += _velocity_y[i] * dt;
+        _age[i] += dt;
+    }
+
+    // iterate backwards, removing moves the last particle into the freed slot
+    for (unsigned int i = _count; i > 0; i--) {
+        if (_age[i - 1] >= _lifetime[i - 1]) {
+            remove(i - 1);
+        }
+    }
+}
+
+void ParticleSystem::clear() {
+    _count = 0;
+}
+
+unsigned int ParticleSystem::getCount() const {
+    return _count;
+}
+
+unsigned int ParticleSystem::getCapacity() const {
+    return _capacity;
+}
+
+unsigned int ParticleSystem::getDroppedParticles() const {
+    return _dropped_particles;
+}
+
+std::span<const float> ParticleSystem::getX() const {
+    return {_x.data(), _count};
+}
+
+std::span<const float> ParticleSystem::getY() const {
+    return {_y.data(), _count};
+}
+
+std::span<const float> ParticleSystem::getSize() const {
+    return {_size.data(), _count};
+}
+
+std::span<const float> ParticleSystem::getAge() const {
+    return {_age.data(), _count};
+}
+
+std::span<const float> ParticleSystem::getLifetime() const {
+    return {_lifetime.data(), _count};
+}
+
+std::span<const ParticleEffect> ParticleSystem::getEffect() const {
+    return {_effect.data(), _count};
+}
+
+void ParticleSystem::remove(unsigned int index) {
+    unsigned int last = _count - 1;
+
+    _x[index] = _x[last];
+    _y[index] = _y[last];
+    _velocity_x[index] = _velocity_x[last];
+    _velocity_y[index] = _velocity_y[last];
+    _size[index] = _size[last];
+    _age[index] = _age[last];
+    _lifetime[index] = _lifetime[last];
+    _effect[index] = _effect[last];
+    _count--;
+}
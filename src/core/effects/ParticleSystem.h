@@ -0,0 +1,67 @@
+#ifndef GAMEENGINE_PARTICLESYSTEM_H
+#define GAMEENGINE_PARTICLESYSTEM_H
+
+
+#include <memory>
+#include <span>
+#include <vector>
+#include "../constants/resource_ids.h"
+#include "../math/Vector2f.h"
+#include "../Random.h"
+
+// fixed capacity particle pool, every attribute lives in its own array and live particles are kept at the front
+class ParticleSystem {
+private:
+    unsigned int _capacity;
+    unsigned int _count;
+    unsigned int _dropped_particles;
+
+    std::vector<float> _x;
+    std::vector<float> _y;
+    std::vector<float> _velocity_x;
+    std::vector<float> _velocity_y;
+    std::vector<float> _size;
+    std::vector<float> _age;
+    std::vector<float> _lifetime;
+    std::vector<ParticleEffect> _effect;
+
+    std::shared_ptr<Random> _random;
+
+public:
+    ParticleSystem(unsigned int capacity, std::shared_ptr<Random> random);
+
+    // spawns are dropped when the pool is full
+    void spawn(ParticleEffect effect, const Vector2f &position, const Vector2f &velocity, float size, float lifetime);
+
+    // particles in random directions with a random speed up to max_speed
+    void spawnBurst(ParticleEffect effect, const Vector2f &position, unsigned int amount, float max_speed, float size,
+                    float lifetime);
+
+    void update(float dt);
+
+    void clear();
+
+    unsigned int getCount() const;
+
+    unsigned int getCapacity() const;
+
+    unsigned int getDroppedParticles() const;
+
+    std::span<const float> getX() const;
+
+    std::span<const float> getY() const;
+
+    std::span<const float> getSize() const;
+
+    std::span<const float> getAge() const;
+
+    std::span<const float> getLifetime() const;
+
+    std::span<const ParticleEffect> getEffect() const;
+
+private:
+    void remove(unsigned int index);
+};
+
+
+#endif //GAMEENGINE_PARTICLESYSTEM_H
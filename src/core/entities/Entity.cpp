@@ -6,7 +6,8 @@ Entity::Entity(const Vector2f &position, std::shared_ptr<Camera> camera, const V
                AnimationPlayer animation_player, AudioPlayer audio_player)
         : _position(position), _scale({1, 1}), _rotation(0), _camera(std::move(camera)), _view_size(view_size),
           _hitbox(nullptr), _animation_player(std::move(animation_player)),
-          _audio_player(std::move(audio_player)) {
+          _audio_player(std::move(audio_player)), _view_dirty(true), _view_screen_version(0),
+          _view_texture_index(0), _view_horizontal_mirror(false) {
 
 }
 
@@ -14,23 +15,28 @@ void Entity::update(double t, float dt) {
     _animation_player.advanceAnimation();
     updateAnimationFrame();
 
-    std::shared_ptr<Vector2f> audio_listener_position = _audio_player.getAudioListenerPosition();
-    if (audio_listener_position != nullptr) {
-        if ((*audio_listener_position - _position).length() <= _audio_player.getMaxDistance()) {
-            setAudioVolume(static_cast<unsigned int>((1 - (*audio_listener_position - _position).length() /
-                                                          _audio_player.getMaxDistance()) * 100));
-        } else {
-            setAudioVolume(0);
-        }
-    }
-
     updateView();
 }
 
 void Entity::updateView() {
+    // the view only depends on the transform, view size and screen resolution, camera movement is applied while
+    // rendering
+    if (!_view_dirty && _view_screen_version == _camera->getScreenVersion()) return;
+
+    _view_dirty = false;
+    _view_screen_version = _camera->getScreenVersion();
+
     notifyObservers();
 }
 
+bool Entity::hasScreenSpaceView() const {
+    return false;
+}
+
+const std::shared_ptr<Camera> &Entity::getCamera() const {
+    return _camera;
+}
+
 Vector2f Entity::getPosition() const {
     return _position;
 }
@@ -48,6 +54,8 @@ void Entity::setPosition(const Vector2f &position) {
         ray->move(position - _position);
     }
 
+    if (!(_position == position)) _view_dirty = true;
+
     _position = position;
 }
 
@@ -72,6 +80,7 @@ void Entity::setScale(const Vector2f &scale) {
         }
     }
     _scale = scale;
+    _view_dirty = true;
 }
 
 void Entity::scale(const Vector2f &scale) {
@@ -84,6 +93,7 @@ float Entity::getRotation() const {
 
 void Entity::setRotation(float rotation) {
     _rotation = rotation;
+    _view_dirty = true;
 }
 
 void Entity::rotate(float rotation) {
@@ -100,6 +110,7 @@ Vector2f Entity::getScreenViewSize() const {
 
 void Entity::setViewSize(const Vector2f &view_size) {
     _view_size = view_size;
+    _view_dirty = true;
 }
 
 const std::shared_ptr<Hitbox> &Entity::getHitbox() {
@@ -128,6 +139,15 @@ const std::vector<std::shared_ptr<Ray>> &Entity::getRays() const {
     return _rays;
 }
 
+std::size_t Entity::getApproximateHeapBytes() const {
+    // the hitbox and the rays are created with make_shared, the control block shares their allocation
+    std::size_t bytes = _rays.capacity() * sizeof(std::shared_ptr<Ray>) +
+                        _rays.size() * (sizeof(Ray) + Census::shared_control_block_bytes);
+    if (_hitbox) bytes += sizeof(Hitbox) + Census::shared_control_block_bytes;
+
+    return bytes;
+}
+
 std::vector<std::shared_ptr<Ray>> Entity::getScreenRays() const {
     std::vector<std::shared_ptr<Ray>> new_rays;
 
@@ -143,8 +163,8 @@ void Entity::setRays(const std::vector<std::shared_ptr<Ray>> &rays) {
     _rays = rays;
 }
 
-std::string Entity::getTextureGroupName() const {
-    return _animation_player.getName();
+TextureGroup Entity::getTextureGroup() const {
+    return _animation_player.getTextureGroup();
 }
 
 bool Entity::isHorizontalMirror() const {
@@ -156,26 +176,41 @@ unsigned int Entity::getCurrentTextureIndex() const {
 }
 
 void Entity::updateAnimationFrame() {
-    notifyObservers(_animation_player.getCurrentTextureIndex(), isHorizontalMirror());
+    unsigned int texture_index = _animation_player.getCurrentTextureIndex();
+    bool horizontal_mirror = isHorizontalMirror();
+    if (texture_index == _view_texture_index && horizontal_mirror == _view_horizontal_mirror) return;
+
+    _view_texture_index = texture_index;
+    _view_horizontal_mirror = horizontal_mirror;
+
+    notifyObservers(texture_index, horizontal_mirror);
 }
 
-void Entity::playAnimation(const std::string &animation_name) {
-    if (_animation_player.getCurrentAnimationName() != animation_name) {
-        _animation_player.startAnimation(animation_name);
+void Entity::playAnimation(AnimationId animation_id) {
+    if (_animation_player.getCurrentAnimation() != animation_id) {
+        _animation_player.startAnimation(animation_id);
         updateAnimationFrame();
     }
 }
 
-void Entity::playSound(const std::string &sound_name, bool finish, bool loop) {
+void Entity::playSound(int sound_id, bool finish, bool loop) {
+    if (sound_id < 0) return;
+
+    _audio_player.setCurrentSound(sound_id);
+
     notifyObservers(finish, 5);
     notifyObservers(loop, 6);
-    notifyObservers(_audio_player.getSoundId(sound_name), 3);
+    notifyObservers(sound_id, 3);
 }
 
-void Entity::playMusic(const std::string &music_name, bool finish, bool loop) {
+void Entity::playMusic(int music_id, bool finish, bool loop) {
+    if (music_id < 0) return;
+
+    _audio_player.setCurrentMusic(music_id);
+
     notifyObservers(finish, 5);
     notifyObservers(loop, 6);
-    notifyObservers(_audio_player.getMusicId(music_name), 4);
+    notifyObservers(music_id, 4);
 }
 
 void Entity::stopSound() {
@@ -189,12 +224,8 @@ void Entity::stopMusic() {
 void Entity::replayAudio() {
     setAudioVolume(_audio_player.getCurrentVolume());
 
-    if (!_audio_player.getCurrentSound().empty()) {
-        playSound(_audio_player.getCurrentSound());
-    }
-    if (!_audio_player.getCurrentMusic().empty()) {
-        playMusic(_audio_player.getCurrentMusic());
-    }
+    playSound(_audio_player.getCurrentSound());
+    playMusic(_audio_player.getCurrentMusic());
 }
 
 void Entity::setAudioVolume(unsigned int volume) {
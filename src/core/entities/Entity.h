@@ -14,6 +14,7 @@
 #include "../physics/Hitbox.h"
 #include "../physics/Ray.h"
 #include "../audio/AudioPlayer.h"
+#include "../profiling/Census.h"
 
 class Entity : public ISubject {
 protected:
@@ -34,6 +35,12 @@ protected:
     AnimationPlayer _animation_player;
     AudioPlayer _audio_player;
 
+    // change tracking, observers are only notified about changes
+    bool _view_dirty;
+    unsigned long long _view_screen_version;
+    unsigned int _view_texture_index;
+    bool _view_horizontal_mirror;
+
 public:
     Entity(const Vector2f &position, std::shared_ptr<Camera> camera, const Vector2f &view_size,
            AnimationPlayer animation_player = {}, AudioPlayer audio_player = {});
@@ -42,6 +49,11 @@ public:
 
     virtual void updateView();
 
+    // screen space views aren't moved by the camera
+    virtual bool hasScreenSpaceView() const;
+
+    const std::shared_ptr<Camera> &getCamera() const;
+
     virtual Vector2f getPosition() const;
 
     virtual Vector2f getScreenPosition() const;
@@ -84,7 +96,10 @@ public:
 
     void setRays(const std::vector<std::shared_ptr<Ray>> &rays);
 
-    std::string getTextureGroupName() const;
+    // heap memory owned by the entity itself, the hitbox and the rays, observers aren't included
+    std::size_t getApproximateHeapBytes() const;
+
+    TextureGroup getTextureGroup() const;
 
     bool isHorizontalMirror() const;
 
@@ -92,11 +107,12 @@ public:
 
     void updateAnimationFrame();
 
-    void playAnimation(const std::string &animation_name);
+    void playAnimation(AnimationId animation_id);
 
-    void playSound(const std::string &sound_name, bool finish = false, bool loop = false);
+    // ids are resolved through the audio player once, negative ids are ignored
+    void playSound(int sound_id, bool finish = false, bool loop = false);
 
-    void playMusic(const std::string &music_name, bool finish = false, bool loop = false);
+    void playMusic(int music_id, bool finish = false, bool loop = false);
 
     void stopSound();
 
@@ -7,16 +7,30 @@
 #include <map>
 #include "Entity.h"
 #include "ui/TextBox.h"
+#include "ui/hp-bar/HPBar.h"
 #include "../animation/Animation.h"
+#include "../effects/ParticleSystem.h"
+#include "../profiling/Census.h"
 
 class IEntityViewCreator {
 public:
-    virtual void loadTextureGroup(const std::string &texture_resource_name,
-                                  const std::vector<std::string> &texture_filenames) = 0;
+    virtual void loadTextureGroup(TextureGroup texture_group, const std::vector<std::string> &texture_filenames) = 0;
 
-    virtual void createEntitySpriteView(std::shared_ptr<Entity> entity, unsigned int layer) = 0;
+    // returns the view so it can be released by removing it from the entity observers
+    virtual std::shared_ptr<IObserver> createEntitySpriteView(std::shared_ptr<Entity> entity, unsigned int layer) = 0;
 
     virtual void createEntityTextView(std::shared_ptr<TextBox> entity_text_box) = 0;
+
+    virtual void createEntityHPBarView(std::shared_ptr<HPBar> hp_bar, unsigned int layer) = 0;
+
+    virtual void loadParticleEffect(ParticleEffect effect, const std::vector<std::string> &texture_filenames) = 0;
+
+    // a single view draws every particle of the system
+    virtual void createParticleSystemView(std::shared_ptr<const ParticleSystem> particle_system,
+                                          unsigned int layer) = 0;
+
+    // adds the live views and the resources they hold
+    virtual void takeCensus(Census &census) = 0;
 };
 
 
@@ -6,7 +6,8 @@ Doodle::Doodle(const Vector2f &position, std::shared_ptr<Camera> camera, const V
                std::shared_ptr<InputMap> input_map, AnimationPlayer animation_player, AudioPlayer audio_player,
                bool is_static)
         : PhysicsEntity(position, std::move(camera), viewSize, std::move(animation_player), std::move(audio_player),
-                        is_static), _input_map(std::move(input_map)), _standing(false), _jumped(false) {
+                        is_static), _input_map(std::move(input_map)), _standing(false), _jumped(false),
+          _scream_sound_id(_audio_player.getSoundId(SoundId::scream)) {
     // hitbox
     _hitbox->setSize({_view_size.x / 3.75f, _view_size.y / 1.25f});
     _hitbox->setOffset({0, -0.072f * _view_size.y});
@@ -35,7 +36,7 @@ Doodle::Doodle(const Vector2f &position, std::shared_ptr<Camera> camera, const V
     _current_hit_points = 3;
 
     // animation
-    playAnimation("jump");
+    playAnimation(AnimationId::jump);
 }
 
 void Doodle::update(double t, float dt) {
@@ -67,7 +68,7 @@ void Doodle::reset() {
 void Doodle::playerController() {
     _standing = false;
 
-    std::string curr_anim = _animation_player.getCurrentAnimationName();
+    AnimationId curr_anim = _animation_player.getCurrentAnimation();
 
 //    // clear player
 //    if (_input_map->r) {
@@ -84,16 +85,16 @@ void Doodle::playerController() {
         }
     }
 
-    if (_standing && curr_anim != "crouch" && curr_anim != "run") {
-        playAnimation("idle");
+    if (_standing && curr_anim != AnimationId::crouch && curr_anim != AnimationId::run) {
+        playAnimation(AnimationId::idle);
     }
 
-    if (_standing && _input_map->s && curr_anim != "run") {
-        playAnimation("crouch");
+    if (_standing && _input_map->s && curr_anim != AnimationId::run) {
+        playAnimation(AnimationId::crouch);
     }
 
-    if ((curr_anim == "crouch" && !_input_map->s) || (curr_anim == "run" && !(_input_map->d || _input_map->a))) {
-        playAnimation("idle");
+    if ((curr_anim == AnimationId::crouch && !_input_map->s) || (curr_anim == AnimationId::run && !(_input_map->d || _input_map->a))) {
+        playAnimation(AnimationId::idle);
     }
 
     // jumping
@@ -103,34 +104,34 @@ void Doodle::playerController() {
         _standing = false;
         _jumped = true;
 
-        playAnimation("jump");
-        playSound("scream", true, false);
+        playAnimation(AnimationId::jump);
+        playSound(_scream_sound_id, true, false);
     }
 
     // falling
-    if (!_standing && _velocity.y < 0 && curr_anim != "fall") {
-        playAnimation("fall");
-    } else if (!_standing && _velocity.y > 0 && curr_anim != "jump") {
-        playAnimation("jump");
+    if (!_standing && _velocity.y < 0 && curr_anim != AnimationId::fall) {
+        playAnimation(AnimationId::fall);
+    } else if (!_standing && _velocity.y > 0 && curr_anim != AnimationId::jump) {
+        playAnimation(AnimationId::jump);
     }
 
     // left / right movement
     if (_input_map->d) {
         _animation_player.setHorizontalMirror(false);
 
-        if (curr_anim != "crouch") _force.x += _horizontal_movement_force;
+        if (curr_anim != AnimationId::crouch) _force.x += _horizontal_movement_force;
 
-        if (_standing && curr_anim != "crouch") {
-            playAnimation("run");
+        if (_standing && curr_anim != AnimationId::crouch) {
+            playAnimation(AnimationId::run);
         }
     }
     if (_input_map->a) {
         _animation_player.setHorizontalMirror(true);
 
-        if (curr_anim != "crouch") _force.x -= _horizontal_movement_force;
+        if (curr_anim != AnimationId::crouch) _force.x -= _horizontal_movement_force;
 
-        if (_standing && curr_anim != "crouch") {
-            playAnimation("run");
+        if (_standing && curr_anim != AnimationId::crouch) {
+            playAnimation(AnimationId::run);
         }
     }
 
@@ -150,3 +151,8 @@ float Doodle::getInitialJumpVelocity() const {
 float Doodle::getHorizontalMovementForce() const {
     return _horizontal_movement_force;
 }
+
+bool Doodle::canSleep() const {
+    // player input
+    return false;
+}
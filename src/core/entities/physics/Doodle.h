@@ -17,6 +17,8 @@ private:
 
     std::shared_ptr<InputMap> _input_map;
 
+    int _scream_sound_id;
+
 public:
     Doodle(const Vector2f &position, std::shared_ptr<Camera> camera, const Vector2f &viewSize,
            std::shared_ptr<InputMap> input_map, AnimationPlayer animation_player = {}, AudioPlayer audio_player = {},
@@ -24,6 +26,8 @@ public:
 
     void update(double t, float dt) override;
 
+    bool canSleep() const override;
+
     void reset();
 
     void playerController();
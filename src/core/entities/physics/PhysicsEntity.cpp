@@ -1,9 +1,11 @@
 #include "PhysicsEntity.h"
 
+#include <algorithm>
+
 PhysicsEntity::PhysicsEntity(const Vector2f &position, std::shared_ptr<Camera> camera, const Vector2f &viewSize,
                              AnimationPlayer animation_player, AudioPlayer audio_player, bool is_static) :
         Entity(position, std::move(camera), viewSize, std::move(animation_player), std::move(audio_player)),
-        _is_static(is_static), _mass(1), _gravitational_acceleration({0, 0}), _passthrough(false), _collided(false),
+        _is_static(is_static), _sleep_state(SleepState::awake), _mass(1), _gravitational_acceleration({0, 0}), _passthrough(false), _collided(false),
         _max_hit_points(0), _current_hit_points(0), _can_shoot(true), _shoot_delay_time_passed(0) {
     _hitbox = std::make_shared<Hitbox>(_position, _view_size);
 
@@ -66,6 +68,8 @@ void PhysicsEntity::update(double t, float dt) {
 }
 
 void PhysicsEntity::setPosition(const Vector2f &position) {
+    wake();
+
     if (_hp_bar) {
         _hp_bar->move(position - _position);
     }
@@ -94,10 +98,12 @@ const Vector2f &PhysicsEntity::getForce() const {
 }
 
 void PhysicsEntity::setForce(const Vector2f &force) {
+    wake();
     _force = force;
 }
 
 void PhysicsEntity::addForce(const Vector2f &force) {
+    wake();
     _force += force;
 }
 
@@ -106,10 +112,12 @@ const Vector2f &PhysicsEntity::getVelocity() const {
 }
 
 void PhysicsEntity::setVelocity(const Vector2f &velocity) {
+    wake();
     _velocity = velocity;
 }
 
 void PhysicsEntity::addVelocity(const Vector2f &velocity) {
+    wake();
     _velocity += velocity;
 }
 
@@ -143,7 +151,7 @@ void PhysicsEntity::applyGravity() {
 
 void PhysicsEntity::applyFriction() {
     Vector2f friction_force = {_velocity.x * _friction.x, _velocity.y * _friction.y};
-    if (_velocity.length() < 0.1) {
+    if (_velocity.lengthSquared() < 0.1f * 0.1f) {
         friction_force *= 3;
     }
     _acceleration -= friction_force;
@@ -171,6 +179,10 @@ void PhysicsEntity::applySideScrolling() {
 }
 
 void PhysicsEntity::resolveCollision(PhysicsEntity &other, bool resolve, bool set_collided) {
+    // contact wakes both entities
+    wake();
+    other.wake();
+
     Vector2f displacement = _hitbox->getDisplacementToCollision(*other._hitbox);
     Vector2f move_vector;
 
@@ -250,7 +262,7 @@ void PhysicsEntity::resolveCollision(PhysicsEntity &other, bool resolve, bool se
         if (_velocity.length() + other._velocity.length() < (_velocity + other._velocity).length()) {
             new_velocity = _velocity + other._velocity;
         } else {
-            new_velocity = _velocity.length() > other._velocity.length() ? _velocity : other._velocity;
+            new_velocity = _velocity.lengthSquared() > other._velocity.lengthSquared() ? _velocity : other._velocity;
         }
 
         _velocity = new_velocity;
@@ -266,10 +278,12 @@ bool PhysicsEntity::isCollided() const {
 }
 
 void PhysicsEntity::setCollided() {
+    wake();
     _collided = true;
 }
 
 void PhysicsEntity::disappear() {
+    wake();
     setHitbox({0, 0}, {0, 0});
     setViewSize({0, 0});
     _rays.clear();
@@ -290,10 +304,12 @@ unsigned int PhysicsEntity::getCurrentHitPoints() const {
 }
 
 void PhysicsEntity::setCurrentHitPoints(unsigned int currentHitPoints) {
+    wake();
     _current_hit_points = currentHitPoints;
 }
 
 void PhysicsEntity::addHitPoints(unsigned int hit_points) {
+    wake();
     _current_hit_points += hit_points;
     if (_current_hit_points > _max_hit_points) {
         _current_hit_points = _max_hit_points;
@@ -301,6 +317,7 @@ void PhysicsEntity::addHitPoints(unsigned int hit_points) {
 }
 
 void PhysicsEntity::subtractHitPoints(unsigned int hit_points) {
+    wake();
     if (_current_hit_points <= hit_points) {
         _current_hit_points = 0;
     } else {
@@ -318,4 +335,39 @@ void PhysicsEntity::setCanShoot(bool can_shoot) {
 
 void PhysicsEntity::setHPBar(const std::shared_ptr<UIEntity> &hp_bar) {
     _hp_bar = hp_bar;
-}
\ No newline at end of file
+}
+SleepState PhysicsEntity::getSleepState() const {
+    return _sleep_state;
+}
+
+bool PhysicsEntity::isSleeping() const {
+    return _sleep_state != SleepState::awake;
+}
+
+void PhysicsEntity::wake() {
+    _sleep_state = SleepState::awake;
+}
+
+void PhysicsEntity::updateSleepState(bool in_activity_area) {
+    if (!canSleep()) {
+        _sleep_state = SleepState::awake;
+    } else if (!in_activity_area) {
+        _sleep_state = SleepState::out_of_margin;
+    } else if (isResting()) {
+        _sleep_state = SleepState::resting;
+    } else {
+        _sleep_state = SleepState::awake;
+    }
+}
+
+bool PhysicsEntity::canSleep() const {
+    return true;
+}
+
+bool PhysicsEntity::isResting() const {
+    if (_animation_player.isAnimating() || !_can_shoot) return false;
+    if (_is_static) return true;
+
+    Vector2f zero = {0, 0};
+    return _velocity == zero && _gravitational_acceleration == zero;
+}
@@ -6,10 +6,19 @@
 #include "../../physics/Ray.h"
 #include "../ui/UIEntity.h"
 
+enum class SleepState {
+    awake,
+    // resting inside the activity area, only the view follows the camera
+    resting,
+    // outside the activity area, not updated and not collided
+    out_of_margin
+};
+
 class PhysicsEntity : public Entity {
 protected:
     bool _is_static;
     bool _collided;
+    SleepState _sleep_state;
 
     // physics
     float _mass;
@@ -113,6 +122,21 @@ public:
     void setCanShoot(bool can_shoot);
 
     void setHPBar(const std::shared_ptr<UIEntity> &hp_bar);
+
+    SleepState getSleepState() const;
+
+    bool isSleeping() const;
+
+    void wake();
+
+    // decides the sleep state for the next tick, called after the update
+    void updateSleepState(bool in_activity_area);
+
+    // entities that always have to be updated return false
+    virtual bool canSleep() const;
+
+    // nothing would change when updating the entity
+    virtual bool isResting() const;
 };
 
 
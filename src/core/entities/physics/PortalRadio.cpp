@@ -12,7 +12,7 @@ PortalRadio::PortalRadio(const Vector2f &position, std::shared_ptr<Camera> camer
     setupPlayerPhysics(0.6, 1);
 
     // start music with loop
-    playMusic("portal_radio", true, true);
+    playMusic(_audio_player.getMusicId(MusicId::portal_radio), true, true);
     setAudioVolume(75);
 }
 
@@ -26,3 +26,7 @@ void PortalRadio::update(double t, float dt) {
 
     PhysicsEntity::update(t, dt);
 }
+
+bool PortalRadio::canSleep() const {
+    return false;
+}
@@ -12,6 +12,8 @@ public:
                 AnimationPlayer animation_player = {}, AudioPlayer audio_player = {}, bool is_static = false);
 
     void update(double t, float dt) override;
+
+    bool canSleep() const override;
 };
 
 
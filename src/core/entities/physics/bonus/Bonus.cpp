@@ -19,6 +19,10 @@ bool Bonus::isActive() const {
     return _active;
 }
 
+bool Bonus::hasTrail() const {
+    return false;
+}
+
 void Bonus::applyEntity(const std::weak_ptr<PhysicsEntity> &other) {
     _affected_entity = other;
     _active = true;
@@ -20,6 +20,9 @@ public:
 
     bool isActive() const;
 
+    // active bonuses that leave a particle trail behind the affected entity
+    virtual bool hasTrail() const;
+
 private:
     virtual void applyEffect() = 0;
 };
@@ -41,3 +41,8 @@ void Enemy::applyEffect() {
 bool Enemy::isShootBack() const {
     return _shoot_back;
 }
+
+bool Enemy::isResting() const {
+    // damage cooldown
+    return _can_damage && SpikeBonus::isResting();
+}
@@ -17,6 +17,8 @@ public:
 
     void update(double t, float dt) override;
 
+    bool isResting() const override;
+
     void applyEffect() override;
 
     bool isShootBack() const;
@@ -4,7 +4,7 @@ HPBonus::HPBonus(const Vector2f &position, std::shared_ptr<Camera> camera, const
                  AnimationPlayer animationPlayer, AudioPlayer audioPlayer, bool isStatic)
         : Bonus(position, std::move(camera), viewSize, std::move(animationPlayer), std::move(audioPlayer), isStatic),
           _hp_addition(1) {
-    playAnimation("red");
+    playAnimation(AnimationId::red);
 }
 
 void HPBonus::update(double t, float dt) {
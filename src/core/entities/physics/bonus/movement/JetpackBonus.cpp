@@ -30,3 +30,11 @@ void JetpackBonus::applyEffect() {
         affected_entity->addForce({0, constants::bonus::jetpack_force_amount});
     }
 }
+
+bool JetpackBonus::hasTrail() const {
+    return _active;
+}
+
+bool JetpackBonus::isResting() const {
+    return !_active && Bonus::isResting();
+}
@@ -15,6 +15,10 @@ public:
 
     void update(double t, float dt) override;
 
+    bool isResting() const override;
+
+    bool hasTrail() const override;
+
     void applyEntity(const std::weak_ptr<PhysicsEntity> &other) override;
 
 private:
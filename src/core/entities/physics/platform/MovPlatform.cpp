@@ -1,9 +1,10 @@
 #include "MovPlatform.h"
 
 MovPlatform::MovPlatform(const Vector2f &position, std::shared_ptr<Camera> camera, const Vector2f &viewSize,
-                         bool horizontal, AnimationPlayer animationPlayer, AudioPlayer audioPlayer, bool isStatic)
+                         bool horizontal, Random &random, AnimationPlayer animationPlayer, AudioPlayer audioPlayer,
+                         bool isStatic)
         : Platform(position, std::move(camera), viewSize, std::move(animationPlayer), std::move(audioPlayer),
-                   isStatic), _horizontal(horizontal), _going_left(Random::get_instance().uniform_int(0, 1)) {
+                   isStatic), _horizontal(horizontal), _going_left(random.uniform_int(0, 1)) {
     if (_horizontal) {
         _bounderies = {constants::camera_view_x_min + _hitbox->getSize().x / 2,
                        constants::camera_view_x_max - _hitbox->getSize().x / 2};
@@ -50,3 +51,8 @@ void MovPlatform::update(double t, float dt) {
 
     PhysicsEntity::update(t, dt);
 }
+
+bool MovPlatform::isResting() const {
+    // scripted motion
+    return false;
+}
@@ -15,10 +15,13 @@ private:
     Vector2f _bounderies;
 
 public:
+    // the random starting direction is drawn from random
     MovPlatform(const Vector2f &position, std::shared_ptr<Camera> camera, const Vector2f &viewSize, bool horizontal,
-                AnimationPlayer animationPlayer = {}, AudioPlayer audioPlayer = {}, bool isStatic = false);
+                Random &random, AnimationPlayer animationPlayer = {}, AudioPlayer audioPlayer = {}, bool isStatic = false);
 
     void update(double t, float dt) override;
+
+    bool isResting() const override;
 };
 
 
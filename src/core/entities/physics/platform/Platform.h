@@ -15,7 +15,8 @@ public:
     Platform(const Vector2f &position, std::shared_ptr<Camera> camera, const Vector2f &viewSize,
              AnimationPlayer animationPlayer = {}, AudioPlayer audioPlayer = {}, bool isStatic = false);
 
-    void addBonus(const std::weak_ptr<Bonus> &bonus);
+    // the bonus is placed at a random horizontal position on the platform
+    void addBonus(const std::weak_ptr<Bonus> &bonus, Random &random);
 
     void setPosition(const Vector2f &position) override;
 };
@@ -1,9 +1,10 @@
 #include "TelePlatform.h"
 
 TelePlatform::TelePlatform(const Vector2f &position, std::shared_ptr<Camera> camera, const Vector2f &viewSize,
-                           bool horizontal, AnimationPlayer animationPlayer, AudioPlayer audioPlayer, bool isStatic)
+                           bool horizontal, std::shared_ptr<Random> random, AnimationPlayer animationPlayer,
+                           AudioPlayer audioPlayer, bool isStatic)
         : Platform(position, std::move(camera), viewSize, std::move(animationPlayer), std::move(audioPlayer),
-                   isStatic), _horizontal(horizontal) {
+                   isStatic), _horizontal(horizontal), _random(std::move(random)) {
     if (_horizontal) {
         _bounderies = {constants::camera_view_x_min + _hitbox->getSize().x / 2,
                        constants::camera_view_x_max - _hitbox->getSize().x / 2};
@@ -26,7 +27,7 @@ void TelePlatform::update(double t, float dt) {
         if (_collided) {
             _collided = false;
 
-            float new_position = Random::get_instance().uniform_real(_bounderies.x, _bounderies.y);
+            float new_position = _random->uniform_real(_bounderies.x, _bounderies.y);
             float distance = std::abs(new_position - _position.x);
 
             if (distance < min_tele_distance) {
@@ -44,7 +45,7 @@ void TelePlatform::update(double t, float dt) {
         if (_collided) {
             _collided = false;
 
-            float new_position = Random::get_instance().uniform_real(_bounderies.x, _bounderies.y);
+            float new_position = _random->uniform_real(_bounderies.x, _bounderies.y);
             float distance = std::abs(new_position - _position.y);
 
             if (distance < min_tele_distance) {
@@ -10,10 +10,12 @@ class TelePlatform : public Platform {
 private:
     bool _horizontal;
     Vector2f _bounderies;
+    // picks the teleport destinations
+    std::shared_ptr<Random> _random;
 
 public:
     TelePlatform(const Vector2f &position, std::shared_ptr<Camera> camera, const Vector2f &viewSize, bool horizontal,
-                 AnimationPlayer animationPlayer = {}, AudioPlayer audioPlayer = {}, bool isStatic = false);
+                 std::shared_ptr<Random> random, AnimationPlayer animationPlayer = {}, AudioPlayer audioPlayer = {}, bool isStatic = false);
 
     void update(double t, float dt) override;
 };
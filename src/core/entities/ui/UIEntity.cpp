@@ -11,6 +11,10 @@ bool UIEntity::isStaticView() const {
     return _static_view;
 }
 
+bool UIEntity::hasScreenSpaceView() const {
+    return _static_view;
+}
+
 bool UIEntity::isRelativePositioning() const {
     return _relative_positioning;
 }
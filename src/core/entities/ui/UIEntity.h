@@ -22,6 +22,9 @@ public:
 
     bool isStaticView() const;
 
+    // static views keep their screen position
+    bool hasScreenSpaceView() const override;
+
     bool isRelativePositioning() const;
 
     void setRelativePositioning(bool relative_positioning);
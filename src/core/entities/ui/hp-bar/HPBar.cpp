@@ -3,44 +3,25 @@
 HPBar::HPBar(const Vector2f &position, std::shared_ptr<Camera> camera, const Vector2f &viewSize,
              AnimationPlayer animationPlayer, AudioPlayer audioPlayer, bool staticView)
         : UIEntity(position, std::move(camera), viewSize, std::move(animationPlayer), std::move(audioPlayer),
-                   staticView), _nr_hp_max(0), _nr_hp_current(0) {
-
+                   staticView), _nr_hp_max(0), _nr_hp_current(0), _heart_size(0, 0), _heart_spacing(0) {
+    _full_texture_index = getAnimationTextureIndex(AnimationId::red);
+    _empty_texture_index = getAnimationTextureIndex(AnimationId::black);
 }
 
-void HPBar::setHearts(std::weak_ptr<PhysicsEntity> entity, const std::weak_ptr<HPBar> &hp_bar_ptr, bool left_alligned,
-                      const Vector2f &heart_size, const Vector2f &offset) {
+void HPBar::setAffectedEntity(std::weak_ptr<PhysicsEntity> entity, const Vector2f &heart_size) {
     _affected_entity = std::move(entity);
+    _heart_size = heart_size;
+    _heart_spacing = _heart_size.x + _heart_size.x * constants::hpbarhearts::horizontal_distance_multiplier;
 
     if (!_affected_entity.expired()) {
         std::shared_ptr<PhysicsEntity> affected_entity = _affected_entity.lock();
         _nr_hp_max = affected_entity->getMaxHitPoints();
-        _view_size = heart_size;
-
-        float x_spacing = _view_size.x + _view_size.x * constants::hpbarhearts::horizontal_distance_multiplier;
-        float current_x_pos;
-        if (left_alligned) {
-            current_x_pos = 0;
-        } else {
-            current_x_pos = -(static_cast<float>(_nr_hp_max - 1) * x_spacing) / 2;
-        }
-
-        for (unsigned int i = 0; i < _nr_hp_max; i++) {
-            Vector2f heart_position = Vector2f(current_x_pos, 0) + offset;
-            _hearts.push_back(std::make_shared<Heart>(
-                    Heart(heart_position, _camera, _view_size, _animation_player)));
-            current_x_pos += x_spacing;
-            addChild(_hearts.back(), hp_bar_ptr);
-        }
-
-        // update if hp not max
-        if (_nr_hp_max != affected_entity->getCurrentHitPoints()) {
-            updateHearts(affected_entity->getCurrentHitPoints());
-        }
+        _nr_hp_current = affected_entity->getCurrentHitPoints();
     }
-}
 
-std::vector<std::shared_ptr<Heart>> HPBar::getHearts() {
-    return _hearts;
+    // the view size covers every heart
+    float width = _nr_hp_max > 0 ? static_cast<float>(_nr_hp_max - 1) * _heart_spacing + _heart_size.x : 0;
+    setViewSize({width, _heart_size.y});
 }
 
 void HPBar::update(double t, float dt) {
@@ -48,25 +29,43 @@ void HPBar::update(double t, float dt) {
         std::shared_ptr<PhysicsEntity> affected_entity = _affected_entity.lock();
 
         if (_nr_hp_current != affected_entity->getCurrentHitPoints()) {
-            updateHearts(affected_entity->getCurrentHitPoints());
+            _nr_hp_current = affected_entity->getCurrentHitPoints();
+            _view_dirty = true;
         }
     }
 
     UIEntity::update(t, dt);
 }
 
-void HPBar::updateHearts(unsigned int current_hp) {
-    _nr_hp_current = current_hp;
+unsigned int HPBar::getMaxHitPoints() const {
+    return _nr_hp_max;
+}
 
-    unsigned int hp_counter = 0;
+unsigned int HPBar::getCurrentHitPoints() const {
+    return _nr_hp_current;
+}
 
-    for (const auto &heart: _hearts) {
-        if (hp_counter < _nr_hp_current) {
-            heart->setFull(true);
-        } else {
-            heart->setFull(false);
-        }
+Vector2f HPBar::getHeartPosition(unsigned int heart_index) const {
+    float first_x_pos = -(static_cast<float>(_nr_hp_max - 1) * _heart_spacing) / 2;
 
-        hp_counter++;
-    }
-}
\ No newline at end of file
+    return _position + Vector2f(first_x_pos + static_cast<float>(heart_index) * _heart_spacing, 0);
+}
+
+Vector2f HPBar::getHeartSize() const {
+    return _heart_size;
+}
+
+unsigned int HPBar::getFullTextureIndex() const {
+    return _full_texture_index;
+}
+
+unsigned int HPBar::getEmptyTextureIndex() const {
+    return _empty_texture_index;
+}
+
+unsigned int HPBar::getAnimationTextureIndex(AnimationId animation_id) const {
+    const std::shared_ptr<AnimationSet> &animations = _animation_player.getAnimations();
+    if (!animations || animations->at(toIndex(animation_id)).texture_indeces.empty()) return 0;
+
+    return animations->at(toIndex(animation_id)).texture_indeces.front();
+}
@@ -2,29 +2,46 @@
 #define GAMEENGINE_HPBAR_H
 
 
-#include "Heart.h"
+#include "../UIEntity.h"
 #include "../../physics/PhysicsEntity.h"
 #include <utility>
 
+// row of hearts centered on the bar position, drawn by a single view straight from the hit points of the entity
 class HPBar : public UIEntity {
 private:
     std::weak_ptr<PhysicsEntity> _affected_entity;
-    std::vector<std::shared_ptr<Heart>> _hearts;
     unsigned int _nr_hp_max;
     unsigned int _nr_hp_current;
 
+    Vector2f _heart_size;
+    float _heart_spacing;
+
+    // texture indices of the heart animations
+    unsigned int _full_texture_index;
+    unsigned int _empty_texture_index;
+
 public:
     HPBar(const Vector2f &position, std::shared_ptr<Camera> camera, const Vector2f &viewSize,
           AnimationPlayer animationPlayer = {}, AudioPlayer audioPlayer = {}, bool staticView = false);
 
-    void setHearts(std::weak_ptr<PhysicsEntity> entity, const std::weak_ptr<HPBar> &hp_bar_ptr, bool left_alligned,
-                   const Vector2f &heart_size, const Vector2f &offset = {0, 0});
-
-    std::vector<std::shared_ptr<Heart>> getHearts();
+    void setAffectedEntity(std::weak_ptr<PhysicsEntity> entity, const Vector2f &heart_size);
 
     void update(double t, float dt) override;
 
-    void updateHearts(unsigned int current_hp);
+    unsigned int getMaxHitPoints() const;
+
+    unsigned int getCurrentHitPoints() const;
+
+    Vector2f getHeartPosition(unsigned int heart_index) const;
+
+    Vector2f getHeartSize() const;
+
+    unsigned int getFullTextureIndex() const;
+
+    unsigned int getEmptyTextureIndex() const;
+
+private:
+    unsigned int getAnimationTextureIndex(AnimationId animation_id) const;
 };
 
 
@@ -0,0 +1,177 @@
+#include "BatchRunner.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "HeadlessViewCreator.h"
+#include "HeadlessAudioCreator.h"
+#include "../World.h"
+#include "../profiling/MemoryUsage.h"
+
+BatchRunner::BatchRunner(const BatchConfig &config) : _config(config) {}
+
+std::vector<BatchResult> BatchRunner::run() const {
+    std::vector<BatchResult> results(_config.worlds);
+
+    unsigned int thread_count = _config.threads;
+    if (thread_count == 0) thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+    thread_count = std::min(thread_count, _config.worlds);
+
+    // the worlds are handed out one at a time, so only thread_count worlds are alive at once
+    std::atomic<unsigned int> next_world = 0;
+    auto worker = [this, &results, &next_world]() {
+        for (unsigned int index = next_world++; index < _config.worlds; index = next_world++) {
+            results[index] = runWorld(index);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(thread_count);
+    for (unsigned int i = 0; i < thread_count; i++) {
+        threads.emplace_back(worker);
+    }
+    for (auto &thread: threads) {
+        thread.join();
+    }
+
+    return results;
+}
+
+BatchResult BatchRunner::runWorld(unsigned int index) const {
+    unsigned int seed = _config.seed + index;
+    std::shared_ptr<Stopwatch> stopwatch = std::make_shared<Stopwatch>();
+    stopwatch->setCapFramerate(false);
+
+    World world(0, 800, 1200, 0, std::make_shared<HeadlessViewCreator>(), std::make_shared<HeadlessAudioCreator>(),
+                stopwatch, std::make_shared<Random>(seed));
+
+    if (_config.doodle_mode) {
+        world.requestDoodleMode(_config.autopilot);
+        // the player jumps whenever it lands on a platform
+        world.getUserInputMap()->w = true;
+    } else {
+        world.requestStressMode(_config.stress_config);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    // a frame of one physics delta time runs a single tick
+    unsigned int ticks = 0;
+    unsigned int peak_physics_entities = 0;
+    CensusEntry peak_census;
+    unsigned long long last_census_sample = world.getCensus().getSampleCount();
+    auto update_peak_census = [&world, &peak_census, &last_census_sample]() {
+        const Census &census = world.getCensus();
+        if (census.getSampleCount() == last_census_sample) return;
+        last_census_sample = census.getSampleCount();
+
+        CensusEntry total = census.getTotal();
+        peak_census.count = std::max(peak_census.count, total.count);
+        peak_census.bytes = std::max(peak_census.bytes, total.bytes);
+    };
+    unsigned long long max_tick_allocations = 0;
+    unsigned long long max_tick_bytes = 0;
+    unsigned long long steady_allocations = 0;
+    unsigned int steady_ticks = 0;
+    Distribution tick_times;
+    Distribution frame_times;
+    tick_times.reserve(_config.ticks);
+    frame_times.reserve(_config.ticks);
+    for (; ticks < _config.ticks && !world.isGameOver(); ticks++) {
+        auto frame_start = std::chrono::steady_clock::now();
+        stopwatch->advanceFrame(stopwatch->getPhysicsDeltaTime());
+        world.update();
+        std::chrono::duration<float, std::milli> frame_time = std::chrono::steady_clock::now() - frame_start;
+
+        const ProfilerFrame &frame = world.getProfiler().getLastFrame();
+        frame_times.add(frame_time.count());
+        // rounding of the accumulator can leave a frame without a tick or with two
+        if (frame.ticks > 0) {
+            float physics_time = frame.getPhase(ProfilerPhase::mode_update).duration +
+                                 frame.getPhase(ProfilerPhase::physics_entities).duration +
+                                 frame.getPhase(ProfilerPhase::particles).duration +
+                                 frame.getPhase(ProfilerPhase::collisions).duration;
+            tick_times.add(physics_time / static_cast<float>(frame.ticks));
+        }
+        peak_physics_entities = std::max(peak_physics_entities, world.getPhysicsEntityCount());
+        update_peak_census();
+
+        // the frame that starts the game over mode loads its ui and clears the level, it isn't a steady state tick
+        if (ticks >= _config.warmup_ticks && !world.isGameOver()) {
+            PhaseSample frame_total = frame.getTotal();
+            max_tick_allocations = std::max(max_tick_allocations, frame_total.allocations);
+            max_tick_bytes = std::max(max_tick_bytes, frame_total.bytes);
+            steady_allocations += frame_total.allocations;
+            steady_ticks++;
+        }
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    world.updateCensus();
+    update_peak_census();
+
+    return {index, seed, ticks, world.getScore(), world.getPhysicsEntityCount(), peak_physics_entities, peak_census,
+            world.isGameOver(), max_tick_allocations, max_tick_bytes, steady_allocations, steady_ticks,
+            std::move(tick_times), std::move(frame_times), elapsed.count(), world.getCensus()};
+}
+
+RunReport BatchRunner::createReport(const std::vector<BatchResult> &results, double elapsed) {
+    unsigned long long ticks = 0;
+    unsigned long long score = 0;
+    unsigned int gameover_worlds = 0;
+    unsigned int peak_physics_entities = 0;
+    unsigned long long max_tick_allocations = 0;
+    unsigned long long max_tick_bytes = 0;
+    unsigned long long steady_allocations = 0;
+    unsigned long long steady_ticks = 0;
+    CensusEntry peak_census;
+    Distribution tick_times;
+    Distribution frame_times;
+    for (const BatchResult &result: results) {
+        ticks += result.ticks;
+        score += result.score;
+        if (result.gameover) gameover_worlds++;
+        peak_physics_entities = std::max(peak_physics_entities, result.peak_physics_entities);
+        max_tick_allocations = std::max(max_tick_allocations, result.max_tick_allocations);
+        max_tick_bytes = std::max(max_tick_bytes, result.max_tick_bytes);
+        steady_allocations += result.steady_allocations;
+        steady_ticks += result.steady_ticks;
+
+        peak_census.count = std::max(peak_census.count, result.peak_census.count);
+        peak_census.bytes = std::max(peak_census.bytes, result.peak_census.bytes);
+
+        tick_times.merge(result.tick_times);
+        frame_times.merge(result.frame_times);
+    }
+
+    RunReport report;
+    // differences in these mean the simulation itself changed, they never fail a comparison
+    report.add("worlds", static_cast<double>(results.size()), MetricDirection::none);
+    report.add("ticks", static_cast<double>(ticks), MetricDirection::none);
+    report.add("score", static_cast<double>(score), MetricDirection::none);
+    report.add("gameover_worlds", gameover_worlds, MetricDirection::none);
+
+    // depends on the thread count and the machine load more than on the code
+    report.add("elapsed", elapsed, MetricDirection::none);
+    report.add("ticks_per_sec", elapsed > 0 ? static_cast<double>(ticks) / elapsed : 0,
+               MetricDirection::higher_is_better);
+    report.addDistribution("tick_ms", tick_times.summarize());
+    report.addDistribution("frame_ms", frame_times.summarize());
+
+    // 0 without allocation tracking
+    report.add("allocations.max_tick", static_cast<double>(max_tick_allocations));
+    report.add("allocations.max_tick_bytes", static_cast<double>(max_tick_bytes));
+    report.add("allocations.mean_tick", steady_ticks > 0 ? static_cast<double>(steady_allocations) /
+                                                           static_cast<double>(steady_ticks) : 0);
+
+    report.add("entities.peak_physics", peak_physics_entities);
+    // over every census sample during the run, the world samples it once per simulated second
+    report.add("entities.peak_census_objects", peak_census.count);
+    report.add("entities.peak_census_bytes", static_cast<double>(peak_census.bytes));
+
+    // of the whole process, so it includes every world that was alive at the same time
+    report.add("memory.peak_rss_bytes", static_cast<double>(memory_usage::getPeakResidentBytes()));
+
+    return report;
+}
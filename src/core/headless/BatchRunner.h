@@ -0,0 +1,72 @@
+#ifndef GAMEENGINE_BATCHRUNNER_H
+#define GAMEENGINE_BATCHRUNNER_H
+
+
+#include <vector>
+#include "../level/StressConfig.h"
+#include "../profiling/Census.h"
+#include "../profiling/Distribution.h"
+#include "../profiling/RunReport.h"
+
+struct BatchConfig {
+    unsigned int worlds{1};
+    // fixed physics ticks simulated per world, a world that reaches game over stops early
+    unsigned int ticks{3600};
+    // ticks before the world counts as steady state, the per tick allocation maxima skip them
+    unsigned int warmup_ticks{600};
+    // 0 uses every hardware thread
+    unsigned int threads{0};
+    // world i is seeded with seed + i so every run of a batch is reproducible
+    unsigned int seed{0};
+    // doodle mode with the player jumping up, otherwise the debug mode with the stress config
+    bool doodle_mode{true};
+    // the doodle mode player steers towards the next platform instead of only jumping in place
+    bool autopilot{false};
+    StressConfig stress_config;
+};
+
+struct BatchResult {
+    unsigned int index;
+    unsigned int seed;
+    unsigned int ticks;
+    unsigned int score;
+    unsigned int physics_entities;
+    // most physics entities alive after any tick
+    unsigned int peak_physics_entities;
+    // largest census total of any periodic sample and of the final census, objects and bytes are maximized separately
+    CensusEntry peak_census;
+    bool gameover;
+    // most heap allocations and bytes of a single steady state tick, 0 without allocation tracking
+    unsigned long long max_tick_allocations;
+    unsigned long long max_tick_bytes;
+    // sum over every steady state tick
+    unsigned long long steady_allocations;
+    unsigned int steady_ticks;
+    // ms of the physics phases of a single tick and of a whole World::update
+    Distribution tick_times;
+    Distribution frame_times;
+    // wall clock time of the simulation in seconds
+    double elapsed;
+    // taken after the last tick
+    Census census;
+};
+
+// simulates many independent headless worlds in parallel, each world runs on a single thread
+class BatchRunner {
+private:
+    BatchConfig _config;
+
+public:
+    explicit BatchRunner(const BatchConfig &config);
+
+    // results are ordered by world index
+    std::vector<BatchResult> run() const;
+
+    BatchResult runWorld(unsigned int index) const;
+
+    // pools the results of every world, elapsed is the wall clock time of the whole batch in seconds
+    static RunReport createReport(const std::vector<BatchResult> &results, double elapsed);
+};
+
+
+#endif //GAMEENGINE_BATCHRUNNER_H
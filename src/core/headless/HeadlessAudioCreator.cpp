@@ -0,0 +1,15 @@
+#include "HeadlessAudioCreator.h"
+
+HeadlessAudioCreator::HeadlessAudioCreator() : _sound_count(0), _music_count(0) {}
+
+unsigned int HeadlessAudioCreator::loadSound(const std::string &, unsigned int) {
+    return _sound_count++;
+}
+
+void HeadlessAudioCreator::playSound(unsigned int, unsigned int) {}
+
+unsigned int HeadlessAudioCreator::loadMusic(const std::string &) {
+    return _music_count++;
+}
+
+void HeadlessAudioCreator::createEntityAudio(std::shared_ptr<Entity>) {}
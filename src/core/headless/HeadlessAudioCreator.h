@@ -0,0 +1,26 @@
+#ifndef GAMEENGINE_HEADLESSAUDIOCREATOR_H
+#define GAMEENGINE_HEADLESSAUDIOCREATOR_H
+
+
+#include "../audio/IEntityAudioCreator.h"
+
+// hands out resource ids without loading or playing anything
+class HeadlessAudioCreator : public IEntityAudioCreator {
+private:
+    unsigned int _sound_count;
+    unsigned int _music_count;
+
+public:
+    HeadlessAudioCreator();
+
+    unsigned int loadSound(const std::string &filename, unsigned int priority) override;
+
+    void playSound(unsigned int sound_id, unsigned int volume) override;
+
+    unsigned int loadMusic(const std::string &filename) override;
+
+    void createEntityAudio(std::shared_ptr<Entity> entity) override;
+};
+
+
+#endif //GAMEENGINE_HEADLESSAUDIOCREATOR_H
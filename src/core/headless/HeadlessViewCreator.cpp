@@ -0,0 +1,59 @@
+#include "HeadlessViewCreator.h"
+
+void HeadlessView::handleEvent() {}
+
+void HeadlessView::handleEvent(const unsigned int &, const unsigned int &) {}
+
+HeadlessViewCreator::HeadlessViewCreator() : _created_views(0) {}
+
+void HeadlessViewCreator::loadTextureGroup(TextureGroup, const std::vector<std::string> &) {}
+
+std::shared_ptr<IObserver> HeadlessViewCreator::createEntitySpriteView(std::shared_ptr<Entity> entity, unsigned int) {
+    // the entity owns its views, same as the sfml views
+    std::shared_ptr<IObserver> view = std::make_shared<HeadlessView>();
+    entity->addObserver(view);
+    addView(view);
+
+    return view;
+}
+
+void HeadlessViewCreator::createEntityTextView(std::shared_ptr<TextBox> entity_text_box) {
+    std::shared_ptr<IObserver> view = std::make_shared<HeadlessView>();
+    entity_text_box->addObserver(view);
+    addView(view);
+}
+
+void HeadlessViewCreator::createEntityHPBarView(std::shared_ptr<HPBar> hp_bar, unsigned int) {
+    std::shared_ptr<IObserver> view = std::make_shared<HeadlessView>();
+    hp_bar->addObserver(view);
+    addView(view);
+}
+
+void HeadlessViewCreator::loadParticleEffect(ParticleEffect, const std::vector<std::string> &) {}
+
+void HeadlessViewCreator::createParticleSystemView(std::shared_ptr<const ParticleSystem>, unsigned int) {}
+
+void HeadlessViewCreator::takeCensus(Census &census) {
+    census.registerType<HeadlessView>("HeadlessView");
+    removeExpiredViews();
+
+    for (const auto &view: _views) {
+        census.add(*view.lock(), Census::shared_control_block_bytes);
+    }
+}
+
+unsigned int HeadlessViewCreator::getCreatedViews() const {
+    return _created_views;
+}
+
+void HeadlessViewCreator::addView(const std::shared_ptr<IObserver> &view) {
+    // released views are only dropped when the list would grow
+    if (_views.size() == _views.capacity()) removeExpiredViews();
+
+    _views.push_back(view);
+    _created_views++;
+}
+
+void HeadlessViewCreator::removeExpiredViews() {
+    std::erase_if(_views, [](const std::weak_ptr<IObserver> &view) { return view.expired(); });
+}
@@ -0,0 +1,47 @@
+#ifndef GAMEENGINE_HEADLESSVIEWCREATOR_H
+#define GAMEENGINE_HEADLESSVIEWCREATOR_H
+
+
+#include "../entities/IEntityViewCreator.h"
+
+// view that ignores every event, stands in for a rendered view when running without a window
+class HeadlessView : public IObserver {
+public:
+    void handleEvent() override;
+
+    void handleEvent(const unsigned int &event, const unsigned int &channel) override;
+};
+
+// creates views that draw nothing so the core can run without SFML, e.g. in benchmarks
+class HeadlessViewCreator : public IEntityViewCreator {
+private:
+    unsigned int _created_views;
+    std::vector<std::weak_ptr<IObserver>> _views;
+
+public:
+    HeadlessViewCreator();
+
+    void loadTextureGroup(TextureGroup texture_group, const std::vector<std::string> &texture_filenames) override;
+
+    std::shared_ptr<IObserver> createEntitySpriteView(std::shared_ptr<Entity> entity, unsigned int layer) override;
+
+    void createEntityTextView(std::shared_ptr<TextBox> entity_text_box) override;
+
+    void createEntityHPBarView(std::shared_ptr<HPBar> hp_bar, unsigned int layer) override;
+
+    void loadParticleEffect(ParticleEffect effect, const std::vector<std::string> &texture_filenames) override;
+
+    void createParticleSystemView(std::shared_ptr<const ParticleSystem> particle_system, unsigned int layer) override;
+
+    void takeCensus(Census &census) override;
+
+    unsigned int getCreatedViews() const;
+
+private:
+    void addView(const std::shared_ptr<IObserver> &view);
+
+    void removeExpiredViews();
+};
+
+
+#endif //GAMEENGINE_HEADLESSVIEWCREATOR_H
@@ -0,0 +1,42 @@
+#ifndef GAMEENGINE_LEVELCHUNK_H
+#define GAMEENGINE_LEVELCHUNK_H
+
+
+#include <array>
+#include "../math/Vector2f.h"
+
+enum class PlatformType {
+    static_platform,
+    temporary,
+    horizontal_moving,
+    vertical_moving,
+    horizontal_teleporting,
+    vertical_teleporting
+};
+
+enum class BonusType {
+    none,
+    spring,
+    jetpack,
+    spikes,
+    heart,
+    enemy,
+    advanced_enemy
+};
+
+struct PlatformSpawn {
+    Vector2f position;
+    PlatformType type{PlatformType::static_platform};
+    BonusType bonus{BonusType::none};
+};
+
+// a ready-made run of consecutive platforms, generated ahead of the camera
+struct LevelChunk {
+    static constexpr unsigned int max_platforms = 8;
+
+    std::array<PlatformSpawn, max_platforms> platforms;
+    unsigned int size{0};
+};
+
+
+#endif //GAMEENGINE_LEVELCHUNK_H
@@ -0,0 +1,136 @@
+#include "LevelGenerator.h"
+
+#include <algorithm>
+#include <chrono>
+#include "../math/math_funcs.h"
+#include "../constants/constants.h"
+#include "../constants/spawn_tables.h"
+
+namespace {
+    template<typename T, std::size_t N>
+    void thresholdWeights(const std::array<constants::spawn::Threshold<T>, N> &table, float sig_val, float scale,
+                          std::vector<float> &weights) {
+        for (std::size_t i = 0; i < N; i++) {
+            weights.push_back(constants::spawn::thresholdWeight(table, i, sig_val) * scale);
+        }
+    }
+}
+
+LevelGenerator::LevelGenerator() : _running(false), _start_y_pos(0), _last_platform_y_pos(0), _difficulty_bucket(-1) {
+
+}
+
+LevelGenerator::~LevelGenerator() {
+    stop();
+}
+
+void LevelGenerator::start(float start_y_pos, unsigned int seed) {
+    stop();
+
+    _chunks.clear();
+    _generator.seed(seed);
+    _start_y_pos = start_y_pos;
+    _last_platform_y_pos = start_y_pos;
+    _difficulty_bucket = -1;
+
+    _running = true;
+    _worker = std::thread(&LevelGenerator::run, this);
+}
+
+void LevelGenerator::stop() {
+    _running = false;
+
+    if (_worker.joinable()) {
+        _worker.join();
+    }
+}
+
+bool LevelGenerator::isRunning() const {
+    return _running;
+}
+
+void LevelGenerator::popChunk(LevelChunk &chunk) {
+    if (!_running) {
+        // no worker, the generator state is safe to use from this thread
+        generateChunk(chunk);
+        return;
+    }
+
+    // the worker runs several chunks ahead, this only waits right after start
+    while (!_chunks.pop(chunk)) {
+        std::this_thread::yield();
+    }
+}
+
+void LevelGenerator::run() {
+    LevelChunk chunk;
+
+    while (_running) {
+        if (_chunks.full()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+
+        generateChunk(chunk);
+        _chunks.push(chunk);
+    }
+}
+
+void LevelGenerator::generateChunk(LevelChunk &chunk) {
+    // the difficulty follows the score the camera earns by climbing to the chunk, unlike the live score it doesn't
+    // lag behind when the worker runs ahead and the level stays a function of the seed
+    float climbed_score = std::max(_last_platform_y_pos - _start_y_pos, 0.f) * constants::camera_score_per_unit;
+    float sig_val = sigmoid(climbed_score, 0.00125, 2);
+    updateSpawnTables(sig_val);
+
+    chunk.size = LevelChunk::max_platforms;
+    for (unsigned int i = 0; i < chunk.size; i++) {
+        chunk.platforms[i] = generatePlatform(sig_val);
+    }
+}
+
+void LevelGenerator::updateSpawnTables(float sig_val) {
+    auto buckets = static_cast<int>(constants::spawn::difficulty_buckets);
+    int difficulty_bucket = std::min(static_cast<int>(sig_val * static_cast<float>(buckets)), buckets - 1);
+    if (difficulty_bucket == _difficulty_bucket) return;
+    _difficulty_bucket = difficulty_bucket;
+
+    // the tables are built for the center of the bucket
+    float bucket_sig_val = (static_cast<float>(difficulty_bucket) + 0.5f) / static_cast<float>(buckets);
+
+    _spawn_weights.clear();
+    thresholdWeights(constants::spawn::platform_table, bucket_sig_val, 1, _spawn_weights);
+    _platform_table.build(_spawn_weights);
+
+    _spawn_weights.clear();
+    _spawn_weights.push_back(1 - constants::spawn::bonus_chance);
+    thresholdWeights(constants::spawn::bonus_table, bucket_sig_val, constants::spawn::bonus_chance, _spawn_weights);
+    _bonus_table.build(_spawn_weights);
+}
+
+PlatformSpawn LevelGenerator::generatePlatform(float sig_val) {
+    PlatformSpawn spawn;
+
+    float y_variation = uniformReal(-0.15f, 0.15f);
+    Vector2f rand_y_bounderies = {0.1f, constants::player::jump_height - 0.1f};
+
+    float rand_y_distance = lerp(rand_y_bounderies.x, rand_y_bounderies.y, sig_val) + y_variation;
+    rand_y_distance = std::clamp(rand_y_distance, rand_y_bounderies.x, rand_y_bounderies.y);
+
+    float x_pos = uniformReal(-0.8, 0.8);
+    _last_platform_y_pos += rand_y_distance;
+    spawn.position = {x_pos, _last_platform_y_pos};
+
+    spawn.type = constants::spawn::platform_table[_platform_table.sample(uniformReal(0, 1))].type;
+
+    // bonus table entry 0 is "no bonus"
+    unsigned int bonus_index = _bonus_table.sample(uniformReal(0, 1));
+    spawn.bonus = bonus_index == 0 ? BonusType::none : constants::spawn::bonus_table[bonus_index - 1].type;
+
+    return spawn;
+}
+
+float LevelGenerator::uniformReal(float a, float b) {
+    std::uniform_real_distribution<float> distribution(a, b);
+    return distribution(_generator);
+}
@@ -0,0 +1,62 @@
+#ifndef GAMEENGINE_LEVELGENERATOR_H
+#define GAMEENGINE_LEVELGENERATOR_H
+
+
+#include <atomic>
+#include <random>
+#include <thread>
+#include "LevelChunk.h"
+#include "SPSCQueue.h"
+#include "../math/AliasTable.h"
+
+// generates doodle mode platforms and bonuses ahead of the camera on a worker thread,
+// the main thread only instantiates the ready-made chunks
+class LevelGenerator {
+private:
+    SPSCQueue<LevelChunk, 8> _chunks;
+
+    std::thread _worker;
+    std::atomic<bool> _running;
+
+    // owned by the worker while it is running
+    std::mt19937 _generator;
+    float _start_y_pos;
+    float _last_platform_y_pos;
+
+    // spawn distributions of the current difficulty bucket
+    int _difficulty_bucket;
+    std::vector<float> _spawn_weights;
+    AliasTable _platform_table;
+    AliasTable _bonus_table;
+
+public:
+    LevelGenerator();
+
+    ~LevelGenerator();
+
+    LevelGenerator(const LevelGenerator &) = delete;
+
+    LevelGenerator &operator=(const LevelGenerator &) = delete;
+
+    void start(float start_y_pos, unsigned int seed);
+
+    void stop();
+
+    bool isRunning() const;
+
+    void popChunk(LevelChunk &chunk);
+
+private:
+    void run();
+
+    void generateChunk(LevelChunk &chunk);
+
+    void updateSpawnTables(float sig_val);
+
+    PlatformSpawn generatePlatform(float sig_val);
+
+    float uniformReal(float a, float b);
+};
+
+
+#endif //GAMEENGINE_LEVELGENERATOR_H
@@ -0,0 +1,57 @@
+#ifndef GAMEENGINE_SPSCQUEUE_H
+#define GAMEENGINE_SPSCQUEUE_H
+
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+// lock-free single producer / single consumer ring buffer
+template<typename T, std::size_t Capacity>
+class SPSCQueue {
+private:
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "SPSCQueue capacity must be a power of two");
+
+    std::array<T, Capacity> _buffer;
+
+    // read and write cursors live on separate cache lines so the two threads don't false share
+    alignas(64) std::atomic<std::size_t> _head{0};
+    alignas(64) std::atomic<std::size_t> _tail{0};
+
+public:
+    // producer
+    bool push(const T &item) {
+        std::size_t tail = _tail.load(std::memory_order_relaxed);
+        if (tail - _head.load(std::memory_order_acquire) == Capacity) return false;
+
+        _buffer[tail & (Capacity - 1)] = item;
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool full() const {
+        return _tail.load(std::memory_order_relaxed) - _head.load(std::memory_order_acquire) == Capacity;
+    }
+
+    // consumer
+    bool pop(T &item) {
+        std::size_t head = _head.load(std::memory_order_relaxed);
+        if (head == _tail.load(std::memory_order_acquire)) return false;
+
+        item = _buffer[head & (Capacity - 1)];
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const {
+        return _head.load(std::memory_order_relaxed) == _tail.load(std::memory_order_acquire);
+    }
+
+    // only safe while the producer is not running
+    void clear() {
+        _head.store(_tail.load(std::memory_order_acquire), std::memory_order_release);
+    }
+};
+
+
+#endif //GAMEENGINE_SPSCQUEUE_H
@@ -0,0 +1,23 @@
+#ifndef GAMEENGINE_STRESSCONFIG_H
+#define GAMEENGINE_STRESSCONFIG_H
+
+
+// extra entities spawned on top of the debug mode scene to measure how the world scales
+struct StressConfig {
+    // platforms of every platform type
+    unsigned int platforms_per_type{0};
+    // enemies standing on their own platform, firing bullets down every fire interval
+    unsigned int enemies{0};
+    float enemy_fire_interval{1.f};
+    // non enemy bonuses standing on their own platform
+    unsigned int bonuses{0};
+    // fills the camera view with background tiles
+    bool background{false};
+
+    bool empty() const {
+        return platforms_per_type == 0 && enemies == 0 && bonuses == 0 && !background;
+    }
+};
+
+
+#endif //GAMEENGINE_STRESSCONFIG_H
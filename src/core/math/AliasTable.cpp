@@ -0,0 +1,86 @@
+#include "AliasTable.h"
+
+AliasTable::AliasTable(const std::vector<float> &weights) {
+    build(weights);
+}
+
+void AliasTable::build(const std::vector<float> &weights) {
+    auto n = static_cast<unsigned int>(weights.size());
+
+    _probabilities.assign(n, 1.f);
+    _aliases.assign(n, 0);
+    if (n == 0) return;
+
+    float total = 0;
+    for (float weight: weights) {
+        total += weight > 0 ? weight : 0;
+    }
+
+    if (total <= 0) {
+        // degenerate table, fall back to a uniform distribution
+        for (unsigned int i = 0; i < n; i++) _aliases[i] = i;
+        return;
+    }
+
+    _scaled.resize(n);
+    _small.clear();
+    _large.clear();
+
+    for (unsigned int i = 0; i < n; i++) {
+        _scaled[i] = (weights[i] > 0 ? weights[i] : 0) * static_cast<float>(n) / total;
+
+        if (_scaled[i] < 1) {
+            _small.push_back(i);
+        } else {
+            _large.push_back(i);
+        }
+    }
+
+    while (!_small.empty() && !_large.empty()) {
+        unsigned int less = _small.back();
+        _small.pop_back();
+        unsigned int more = _large.back();
+        _large.pop_back();
+
+        _probabilities[less] = _scaled[less];
+        _aliases[less] = more;
+
+        _scaled[more] = (_scaled[more] + _scaled[less]) - 1;
+
+        if (_scaled[more] < 1) {
+            _small.push_back(more);
+        } else {
+            _large.push_back(more);
+        }
+    }
+
+    // leftovers are (up to rounding errors) exactly full columns
+    for (unsigned int i: _large) {
+        _probabilities[i] = 1;
+        _aliases[i] = i;
+    }
+    for (unsigned int i: _small) {
+        _probabilities[i] = 1;
+        _aliases[i] = i;
+    }
+}
+
+unsigned int AliasTable::sample(float uniform) const {
+    auto n = static_cast<unsigned int>(_probabilities.size());
+
+    float column_position = uniform * static_cast<float>(n);
+    auto column = static_cast<unsigned int>(column_position);
+    if (column >= n) column = n - 1;
+
+    float coin = column_position - static_cast<float>(column);
+
+    return coin < _probabilities[column] ? column : _aliases[column];
+}
+
+unsigned int AliasTable::size() const {
+    return static_cast<unsigned int>(_probabilities.size());
+}
+
+bool AliasTable::empty() const {
+    return _probabilities.empty();
+}
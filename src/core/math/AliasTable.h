@@ -0,0 +1,35 @@
+#ifndef GAMEENGINE_ALIASTABLE_H
+#define GAMEENGINE_ALIASTABLE_H
+
+
+#include <vector>
+
+// discrete distribution sampled in O(1) with Vose's alias method
+class AliasTable {
+private:
+    std::vector<float> _probabilities;
+    std::vector<unsigned int> _aliases;
+
+    // build worklists, kept to avoid reallocating on rebuild
+    std::vector<float> _scaled;
+    std::vector<unsigned int> _small;
+    std::vector<unsigned int> _large;
+
+public:
+    AliasTable() = default;
+
+    explicit AliasTable(const std::vector<float> &weights);
+
+    // weights don't need to be normalized, at least one weight must be positive
+    void build(const std::vector<float> &weights);
+
+    // a single uniform number in [0, 1) picks both the column and the coin flip
+    unsigned int sample(float uniform) const;
+
+    unsigned int size() const;
+
+    bool empty() const;
+};
+
+
+#endif //GAMEENGINE_ALIASTABLE_H
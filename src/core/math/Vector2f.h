@@ -3,87 +3,218 @@
 
 #include <cmath>
 #include <iostream>
+#include <span>
+#include <string>
+#include <type_traits>
 
+// header only so the arithmetic inlines into the physics code, implicit copy keeps it trivially copyable
 class Vector2f {
 public:
     float x;
     float y;
 
-    Vector2f();
+    constexpr Vector2f() : x(0), y(0) {}
 
-    Vector2f(float _x, float _y);
+    constexpr Vector2f(float _x, float _y) : x(_x), y(_y) {}
 
-    Vector2f(const Vector2f &other);
+    constexpr Vector2f operator+(const Vector2f &other) const { return {x + other.x, y + other.y}; }
 
-    Vector2f &operator=(const Vector2f &other);
+    constexpr Vector2f operator+(float scalar) const { return {x + scalar, y + scalar}; }
 
-    Vector2f operator+(const Vector2f &other) const;
+    friend constexpr Vector2f operator+(float scalar, const Vector2f &other) {
+        return {scalar + other.x, scalar + other.y};
+    }
 
-    Vector2f operator+(float scalar) const;
+    constexpr Vector2f &operator+=(const Vector2f &other) {
+        x += other.x;
+        y += other.y;
+        return *this;
+    }
 
-    friend Vector2f operator+(float scalar, const Vector2f &other);
+    constexpr Vector2f &operator+=(float scalar) {
+        x += scalar;
+        y += scalar;
+        return *this;
+    }
 
-    Vector2f &operator+=(const Vector2f &other);
+    constexpr Vector2f operator-(const Vector2f &other) const { return {x - other.x, y - other.y}; }
 
-    Vector2f &operator+=(float scalar);
+    constexpr Vector2f operator-(float scalar) const { return {x - scalar, y - scalar}; }
 
-    Vector2f operator-(const Vector2f &other) const;
+    friend constexpr Vector2f operator-(float scalar, const Vector2f &other) {
+        return {scalar - other.x, scalar - other.y};
+    }
 
-    Vector2f operator-(float scalar) const;
+    constexpr Vector2f &operator-=(const Vector2f &other) {
+        x -= other.x;
+        y -= other.y;
+        return *this;
+    }
 
-    friend Vector2f operator-(float scalar, const Vector2f &other);
+    constexpr Vector2f &operator-=(float scalar) {
+        x -= scalar;
+        y -= scalar;
+        return *this;
+    }
 
-    Vector2f &operator-=(const Vector2f &other);
+    constexpr Vector2f operator*(float scalar) const { return {x * scalar, y * scalar}; }
 
-    Vector2f &operator-=(float scalar);
+    friend constexpr Vector2f operator*(float scalar, const Vector2f &other) {
+        return {scalar * other.x, scalar * other.y};
+    }
 
-    Vector2f operator*(float scalar) const;
+    constexpr Vector2f &operator*=(float scalar) {
+        x *= scalar;
+        y *= scalar;
+        return *this;
+    }
 
-    friend Vector2f operator*(float scalar, const Vector2f &other);
+    constexpr Vector2f operator/(float scalar) const { return {x / scalar, y / scalar}; }
 
-    Vector2f &operator*=(float scalar);
+    friend constexpr Vector2f operator/(float scalar, const Vector2f &other) {
+        return {other.x / scalar, other.y / scalar};
+    }
 
-    Vector2f operator/(float scalar) const;
+    constexpr Vector2f &operator/=(float scalar) {
+        x /= scalar;
+        y /= scalar;
+        return *this;
+    }
 
-    friend Vector2f operator/(float scalar, const Vector2f &other);
+    constexpr bool operator==(const Vector2f &other) const { return (x == other.x) && (y == other.y); }
 
-    Vector2f &operator/=(float scalar);
+    constexpr bool operator<(const Vector2f &other) const { return (x < other.x) && (y < other.y); }
 
-    bool operator==(const Vector2f &other) const;
+    constexpr bool operator<=(const Vector2f &other) const { return (x <= other.x) && (y <= other.y); }
 
-    bool operator<(const Vector2f &other) const;
+    constexpr bool operator>(const Vector2f &other) const { return (x > other.x) && (y > other.y); }
 
-    bool operator<=(const Vector2f &other) const;
+    constexpr bool operator>=(const Vector2f &other) const { return (x >= other.x) && (y >= other.y); }
 
-    bool operator>(const Vector2f &other) const;
+    friend std::ostream &operator<<(std::ostream &os, const Vector2f &vector) {
+        os << "(" << vector.x << ", " << vector.y << ")";
+        return os;
+    }
 
-    bool operator>=(const Vector2f &other) const;
+    std::string toString() const {
+        return "(" + std::to_string(x) + ", " + std::to_string(y) + ")";
+    }
 
-    friend std::ostream &operator<<(std::ostream &os, const Vector2f &vector);
+    constexpr bool empty() const { return x == 0 && y == 0; }
 
-    std::string toString() const;
+    constexpr void clear() {
+        x = 0;
+        y = 0;
+    }
 
-    bool empty() const;
+    // prefer for comparisons, no square root
+    constexpr float lengthSquared() const { return x * x + y * y; }
 
-    void clear();
+    float length() const { return std::sqrt(lengthSquared()); }
 
-    float length() const;
+    void normalize() {
+        float length = this->length();
+        x /= length;
+        y /= length;
+    }
 
-    void normalize();
+    Vector2f normalized() const {
+        Vector2f new_vector = *this;
+        new_vector.normalize();
+        return new_vector;
+    }
 
-    Vector2f normalized();
+    constexpr float dotProduct(const Vector2f &other) const { return x * other.x + y * other.y; }
 
-    float dotProduct(const Vector2f &other) const;
+    constexpr float crossProduct(const Vector2f &other) const { return (x * other.y) - (y * other.x); }
 
-    float crossProduct(const Vector2f &other) const;
+    void rotate(float angle_radian, const Vector2f &pivot_point = {0, 0}) {
+        if (pivot_point == *this)
+            return;
 
-    void rotate(float angle_radian, const Vector2f &pivot_point = {0, 0});
+        // translate point back to origin pivot
+        *this -= pivot_point;
 
-    Vector2f rotated(float angle_radian, const Vector2f &pivot_point = {0, 0}) const;
+        // rotated endpoint
+        float cos_angle = std::cos(angle_radian);
+        float sin_angle = std::sin(angle_radian);
+        Vector2f new_point = {x * cos_angle - y * sin_angle, x * sin_angle + y * cos_angle};
 
-    void scale(const Vector2f &scale, const Vector2f &pivot_point = {0, 0});
+        // translate point back to pivot point
+        *this = pivot_point + new_point;
+    }
 
-    Vector2f scaled(const Vector2f &scale, const Vector2f &pivot_point = {0, 0}) const;
+    Vector2f rotated(float angle_radian, const Vector2f &pivot_point = {0, 0}) const {
+        if (pivot_point == *this)
+            return *this;
+
+        Vector2f rotated_point = *this;
+
+        rotated_point.rotate(angle_radian, pivot_point);
+
+        return rotated_point;
+    }
+
+    constexpr void scale(const Vector2f &scale, const Vector2f &pivot_point = {0, 0}) {
+        if (pivot_point == *this)
+            return;
+
+        // translate point back to origin pivot
+        *this -= pivot_point;
+
+        // scaled endpoint
+        x *= scale.x;
+        y *= scale.y;
+
+        // translate point back to pivot point
+        *this += pivot_point;
+    }
+
+    constexpr Vector2f scaled(const Vector2f &scale, const Vector2f &pivot_point = {0, 0}) const {
+        if (pivot_point == *this)
+            return *this;
+
+        Vector2f scaled_point = *this;
+
+        scaled_point.scale(scale, pivot_point);
+
+        return scaled_point;
+    }
 };
 
-#endif // GAMEENGINE_VECTOR2F_H
\ No newline at end of file
+static_assert(std::is_trivially_copyable_v<Vector2f>, "Vector2f is copied around by value and in bulk");
+
+// batch helpers over contiguous vectors, plain loops the compiler can vectorize
+namespace vector2f {
+    // points[i] += deltas[i] * factor
+    constexpr void addScaled(std::span<Vector2f> points, std::span<const Vector2f> deltas, float factor) {
+        for (std::size_t i = 0; i < points.size() && i < deltas.size(); i++) {
+            points[i].x += deltas[i].x * factor;
+            points[i].y += deltas[i].y * factor;
+        }
+    }
+
+    constexpr void translate(std::span<Vector2f> points, const Vector2f &offset) {
+        for (auto &point: points) {
+            point.x += offset.x;
+            point.y += offset.y;
+        }
+    }
+
+    constexpr void lengthsSquared(std::span<const Vector2f> vectors, std::span<float> lengths_squared) {
+        for (std::size_t i = 0; i < vectors.size() && i < lengths_squared.size(); i++) {
+            lengths_squared[i] = vectors[i].x * vectors[i].x + vectors[i].y * vectors[i].y;
+        }
+    }
+
+    constexpr void distancesSquared(std::span<const Vector2f> points, const Vector2f &origin,
+                                    std::span<float> distances_squared) {
+        for (std::size_t i = 0; i < points.size() && i < distances_squared.size(); i++) {
+            float dx = points[i].x - origin.x;
+            float dy = points[i].y - origin.y;
+            distances_squared[i] = dx * dx + dy * dy;
+        }
+    }
+}
+
+#endif // GAMEENGINE_VECTOR2F_H
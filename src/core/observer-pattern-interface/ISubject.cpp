@@ -4,6 +4,8 @@ void ISubject::addObserver(const std::shared_ptr<IObserver> &observer) { _observ
 
 void ISubject::removeObserver(const std::shared_ptr<IObserver> &observer) { _observers.erase(observer); }
 
+std::size_t ISubject::getObserverCount() const { return _observers.size(); }
+
 void ISubject::notifyObservers() {
     for (const auto &observer: _observers) {
         observer->handleEvent();
@@ -17,6 +17,8 @@ public:
     virtual void notifyObservers();
 
     virtual void notifyObservers(const unsigned int &event, const unsigned int &channel);
+
+    std::size_t getObserverCount() const;
 };
 
 #endif // GAMEENGINE_ISUBJECT_H
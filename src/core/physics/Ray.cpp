@@ -74,7 +74,7 @@ bool Ray::collides(const Vector2f &other_origin_point, const Vector2f &other_end
         Vector2f closest_intersection;
         if (is_collinear) {
             // check the closest intersection of 1 & 2
-            if ((intersection1 - _origin_point).length() < (intersection2 - _origin_point).length()) {
+            if ((intersection1 - _origin_point).lengthSquared() < (intersection2 - _origin_point).lengthSquared()) {
                 closest_intersection = intersection1;
             } else {
                 closest_intersection = intersection2;
@@ -85,7 +85,8 @@ bool Ray::collides(const Vector2f &other_origin_point, const Vector2f &other_end
 
         // check the closest point of closest intersection and previous intersection;
         if (_collided) {
-            if ((closest_intersection - _origin_point).length() < (_collision_point - _origin_point).length()) {
+            if ((closest_intersection - _origin_point).lengthSquared() <
+                (_collision_point - _origin_point).lengthSquared()) {
                 _collision_point = closest_intersection;
             }
             _collided = true;
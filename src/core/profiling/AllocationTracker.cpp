@@ -0,0 +1,66 @@
+#include "AllocationTracker.h"
+
+#ifdef GAMEENGINE_TRACK_ALLOCATIONS
+
+#include <cstdlib>
+#include <new>
+
+namespace {
+    // per thread so worlds simulated in parallel don't count each others allocations
+    thread_local allocation_tracker::AllocationCounts thread_counts;
+
+    void *allocate(std::size_t size) {
+        thread_counts.allocations++;
+        thread_counts.bytes += size;
+
+        // malloc(0) may return nullptr, new has to return a unique pointer
+        return std::malloc(size == 0 ? 1 : size);
+    }
+
+    void deallocate(void *pointer) {
+        if (!pointer) return;
+
+        thread_counts.deallocations++;
+        std::free(pointer);
+    }
+}
+
+void *operator new(std::size_t size) {
+    void *pointer = allocate(size);
+    if (!pointer) throw std::bad_alloc();
+    return pointer;
+}
+
+void *operator new[](std::size_t size) {
+    void *pointer = allocate(size);
+    if (!pointer) throw std::bad_alloc();
+    return pointer;
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept { return allocate(size); }
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept { return allocate(size); }
+
+void operator delete(void *pointer) noexcept { deallocate(pointer); }
+
+void operator delete[](void *pointer) noexcept { deallocate(pointer); }
+
+void operator delete(void *pointer, std::size_t) noexcept { deallocate(pointer); }
+
+void operator delete[](void *pointer, std::size_t) noexcept { deallocate(pointer); }
+
+void operator delete(void *pointer, const std::nothrow_t &) noexcept { deallocate(pointer); }
+
+void operator delete[](void *pointer, const std::nothrow_t &) noexcept { deallocate(pointer); }
+
+allocation_tracker::AllocationCounts allocation_tracker::getThreadCounts() {
+    return thread_counts;
+}
+
+#else
+
+allocation_tracker::AllocationCounts allocation_tracker::getThreadCounts() {
+    return {};
+}
+
+#endif
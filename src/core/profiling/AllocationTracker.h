@@ -0,0 +1,28 @@
+#ifndef GAMEENGINE_ALLOCATIONTRACKER_H
+#define GAMEENGINE_ALLOCATIONTRACKER_H
+
+
+// counts heap allocations of the calling thread, the global operator new/delete are only replaced when the core is
+// built with GAMEENGINE_TRACK_ALLOCATIONS, otherwise every count stays 0
+namespace allocation_tracker {
+    struct AllocationCounts {
+        unsigned long long allocations{0};
+        unsigned long long deallocations{0};
+        // requested bytes of the allocations
+        unsigned long long bytes{0};
+    };
+
+    constexpr bool isEnabled() {
+#ifdef GAMEENGINE_TRACK_ALLOCATIONS
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    // running totals since the thread started, subtract two samples to get the allocations in between
+    AllocationCounts getThreadCounts();
+}
+
+
+#endif //GAMEENGINE_ALLOCATIONTRACKER_H
@@ -0,0 +1,44 @@
+#include "Census.h"
+
+Census::Census() : _samples(0) {}
+
+void Census::add(const std::string &name, unsigned int count, std::size_t bytes) {
+    CensusEntry &entry = _entries[getEntryIndex(name)];
+    entry.count += count;
+    entry.bytes += bytes;
+}
+
+void Census::beginSample() {
+    for (CensusEntry &entry: _entries) {
+        entry.count = 0;
+        entry.bytes = 0;
+    }
+
+    _samples++;
+}
+
+const std::vector<CensusEntry> &Census::getEntries() const {
+    return _entries;
+}
+
+CensusEntry Census::getTotal() const {
+    CensusEntry total{"total"};
+    for (const CensusEntry &entry: _entries) {
+        total.count += entry.count;
+        total.bytes += entry.bytes;
+    }
+    return total;
+}
+
+unsigned long long Census::getSampleCount() const {
+    return _samples;
+}
+
+std::size_t Census::getEntryIndex(const std::string &name) {
+    auto named_entry = _named_entries.find(name);
+    if (named_entry != _named_entries.end()) return named_entry->second;
+
+    _entries.push_back({name});
+    _named_entries.emplace(name, _entries.size() - 1);
+    return _entries.size() - 1;
+}
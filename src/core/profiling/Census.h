@@ -0,0 +1,75 @@
+#ifndef GAMEENGINE_CENSUS_H
+#define GAMEENGINE_CENSUS_H
+
+
+#include <cstddef>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+struct CensusEntry {
+    std::string name;
+    unsigned int count{0};
+    // approximate, the objects themselves plus the heap memory they own
+    std::size_t bytes{0};
+};
+
+// live object counts and approximate memory per concrete type, objects are counted by their dynamic type
+class Census {
+private:
+    struct TypeInfo {
+        std::size_t entry_index;
+        std::size_t size;
+    };
+
+    std::vector<CensusEntry> _entries;
+    std::unordered_map<std::type_index, TypeInfo> _types;
+    std::unordered_map<std::string, std::size_t> _named_entries;
+    unsigned long long _samples;
+
+public:
+    // objects created with std::make_shared share an allocation with their control block
+    static constexpr std::size_t shared_control_block_bytes = 2 * sizeof(void *);
+
+    Census();
+
+    template<typename T>
+    void registerType(const std::string &name) {
+        _types.insert_or_assign(std::type_index(typeid(T)), TypeInfo{getEntryIndex(name), sizeof(T)});
+    }
+
+    // object_bytes is added on top of the size of the concrete type, unregistered types get their own entry named
+    // after the type and are sized by the static type
+    template<typename T>
+    void add(const T &object, std::size_t object_bytes = 0) {
+        auto type = _types.find(std::type_index(typeid(object)));
+        if (type == _types.end()) {
+            type = _types.emplace(std::type_index(typeid(object)),
+                                  TypeInfo{getEntryIndex(typeid(object).name()), sizeof(T)}).first;
+        }
+
+        CensusEntry &entry = _entries[type->second.entry_index];
+        entry.count++;
+        entry.bytes += type->second.size + object_bytes;
+    }
+
+    // objects that aren't counted one by one
+    void add(const std::string &name, unsigned int count, std::size_t bytes);
+
+    // clears the counts of every entry and starts a new sample
+    void beginSample();
+
+    const std::vector<CensusEntry> &getEntries() const;
+
+    CensusEntry getTotal() const;
+
+    unsigned long long getSampleCount() const;
+
+private:
+    std::size_t getEntryIndex(const std::string &name);
+};
+
+
+#endif //GAMEENGINE_CENSUS_H
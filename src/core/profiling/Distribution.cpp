@@ -0,0 +1,38 @@
+#include "Distribution.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+void Distribution::reserve(std::size_t count) {
+    _samples.reserve(count);
+}
+
+void Distribution::add(float sample) {
+    _samples.push_back(sample);
+}
+
+void Distribution::merge(const Distribution &other) {
+    _samples.insert(_samples.end(), other._samples.begin(), other._samples.end());
+}
+
+std::size_t Distribution::getCount() const {
+    return _samples.size();
+}
+
+DistributionSummary Distribution::summarize() const {
+    if (_samples.empty()) return {};
+
+    std::vector<float> sorted = _samples;
+    std::sort(sorted.begin(), sorted.end());
+
+    auto percentile = [&sorted](float p) {
+        auto rank = static_cast<std::size_t>(std::ceil(p * static_cast<float>(sorted.size())));
+        return sorted[std::clamp<std::size_t>(rank, 1, sorted.size()) - 1];
+    };
+
+    double sum = std::accumulate(sorted.begin(), sorted.end(), 0.0);
+
+    return {sorted.size(), sorted.front(), static_cast<float>(sum / static_cast<double>(sorted.size())),
+            percentile(0.5f), percentile(0.9f), percentile(0.99f), sorted.back()};
+}
@@ -0,0 +1,31 @@
+#include "MemoryUsage.h"
+
+#ifdef WIN32
+
+#include <windows.h>
+#include <psapi.h>
+
+std::size_t memory_usage::getPeakResidentBytes() {
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return 0;
+    return counters.PeakWorkingSetSize;
+}
+
+#else
+
+#include <sys/resource.h>
+
+std::size_t memory_usage::getPeakResidentBytes() {
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+
+#ifdef __APPLE__
+    // bytes on macOS
+    return static_cast<std::size_t>(usage.ru_maxrss);
+#else
+    // KiB on linux
+    return static_cast<std::size_t>(usage.ru_maxrss) * 1024;
+#endif
+}
+
+#endif
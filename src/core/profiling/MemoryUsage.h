@@ -0,0 +1,14 @@
+#ifndef GAMEENGINE_MEMORYUSAGE_H
+#define GAMEENGINE_MEMORYUSAGE_H
+
+
+#include <cstddef>
+
+// resident set size of the whole process, worlds simulated in parallel share it
+namespace memory_usage {
+    // largest resident set size since the process started, 0 where the platform doesn't report it
+    std::size_t getPeakResidentBytes();
+}
+
+
+#endif //GAMEENGINE_MEMORYUSAGE_H
@@ -0,0 +1,77 @@
+#include "Profiler.h"
+
+const PhaseSample &ProfilerFrame::getPhase(ProfilerPhase phase) const {
+    return phases[static_cast<unsigned int>(phase)];
+}
+
+PhaseSample ProfilerFrame::getTotal() const {
+    PhaseSample total;
+    for (const PhaseSample &phase: phases) {
+        total.duration += phase.duration;
+        total.allocations += phase.allocations;
+        total.bytes += phase.bytes;
+    }
+    return total;
+}
+
+Profiler::Scope::Scope(Profiler &profiler, ProfilerPhase phase)
+        : _profiler(profiler), _phase(phase), _start(std::chrono::steady_clock::now()),
+          _start_counts(allocation_tracker::getThreadCounts()) {}
+
+Profiler::Scope::~Scope() {
+    allocation_tracker::AllocationCounts counts = allocation_tracker::getThreadCounts();
+    std::chrono::duration<float, std::milli> duration = std::chrono::steady_clock::now() - _start;
+
+    _profiler.addSample(_phase, {duration.count(), counts.allocations - _start_counts.allocations,
+                                 counts.bytes - _start_counts.bytes});
+}
+
+Profiler::Profiler() : _frame_count(0) {}
+
+void Profiler::beginFrame() {
+    _current_frame = {};
+}
+
+void Profiler::endFrame() {
+    _last_frame = _current_frame;
+    _frame_count++;
+}
+
+void Profiler::addTick() {
+    _current_frame.ticks++;
+}
+
+void Profiler::addSample(ProfilerPhase phase, const PhaseSample &sample) {
+    PhaseSample &current = _current_frame.phases[static_cast<unsigned int>(phase)];
+    current.duration += sample.duration;
+    current.allocations += sample.allocations;
+    current.bytes += sample.bytes;
+}
+
+const ProfilerFrame &Profiler::getLastFrame() const {
+    return _last_frame;
+}
+
+unsigned long long Profiler::getFrameCount() const {
+    return _frame_count;
+}
+
+std::string_view Profiler::getPhaseName(ProfilerPhase phase) {
+    switch (phase) {
+        case ProfilerPhase::game_update:
+            return "game_update";
+        case ProfilerPhase::mode_update:
+            return "mode_update";
+        case ProfilerPhase::physics_entities:
+            return "physics_entities";
+        case ProfilerPhase::particles:
+            return "particles";
+        case ProfilerPhase::collisions:
+            return "collisions";
+        case ProfilerPhase::lazy_views:
+            return "lazy_views";
+        case ProfilerPhase::count:
+            break;
+    }
+    return "";
+}
@@ -0,0 +1,81 @@
+#ifndef GAMEENGINE_PROFILER_H
+#define GAMEENGINE_PROFILER_H
+
+
+#include <array>
+#include <chrono>
+#include <string_view>
+#include "AllocationTracker.h"
+
+// parts of World::update, the physics phases add up over every tick of a frame
+enum class ProfilerPhase : unsigned int {
+    game_update,
+    mode_update,
+    physics_entities,
+    particles,
+    collisions,
+    lazy_views,
+    count
+};
+
+struct PhaseSample {
+    float duration{0}; // ms
+    unsigned long long allocations{0};
+    unsigned long long bytes{0};
+};
+
+struct ProfilerFrame {
+    std::array<PhaseSample, static_cast<unsigned int>(ProfilerPhase::count)> phases;
+    unsigned int ticks{0};
+
+    const PhaseSample &getPhase(ProfilerPhase phase) const;
+
+    // sum of every phase
+    PhaseSample getTotal() const;
+};
+
+class Profiler {
+private:
+    ProfilerFrame _current_frame;
+    ProfilerFrame _last_frame;
+    unsigned long long _frame_count;
+
+public:
+    // measures the time and the allocations of the calling thread until it goes out of scope
+    class Scope {
+    private:
+        Profiler &_profiler;
+        ProfilerPhase _phase;
+        std::chrono::steady_clock::time_point _start;
+        allocation_tracker::AllocationCounts _start_counts;
+
+    public:
+        Scope(Profiler &profiler, ProfilerPhase phase);
+
+        Scope(const Scope &) = delete;
+
+        Scope &operator=(const Scope &) = delete;
+
+        ~Scope();
+    };
+
+    Profiler();
+
+    void beginFrame();
+
+    void endFrame();
+
+    void addTick();
+
+    void addSample(ProfilerPhase phase, const PhaseSample &sample);
+
+    // the last completed frame
+    const ProfilerFrame &getLastFrame() const;
+
+    unsigned long long getFrameCount() const;
+
+    static std::string_view getPhaseName(ProfilerPhase phase);
+};
+
+
+#endif //GAMEENGINE_PROFILER_H
@@ -0,0 +1,211 @@
+#include "RunReport.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <string_view>
+
+namespace {
+    std::string_view getDirectionName(MetricDirection direction) {
+        switch (direction) {
+            case MetricDirection::lower_is_better:
+                return "lower";
+            case MetricDirection::higher_is_better:
+                return "higher";
+            case MetricDirection::none:
+                return "none";
+        }
+        return "none";
+    }
+
+    std::optional<MetricDirection> parseDirection(std::string_view name) {
+        if (name == "lower") return MetricDirection::lower_is_better;
+        if (name == "higher") return MetricDirection::higher_is_better;
+        if (name == "none") return MetricDirection::none;
+        return std::nullopt;
+    }
+
+    std::optional<double> parseValue(const std::string &text) {
+        // strtod instead of std::from_chars, older standard libraries don't parse floating point with it
+        const char *begin = text.c_str();
+        char *end = nullptr;
+        double value = std::strtod(begin, &end);
+        if (end == begin) return std::nullopt;
+        return value;
+    }
+
+    // the text after "key": up to the next delimiter, quotes of string values are removed
+    std::optional<std::string> findJsonValue(const std::string &object, const std::string &key) {
+        std::size_t key_position = object.find("\"" + key + "\":");
+        if (key_position == std::string::npos) return std::nullopt;
+
+        std::size_t begin = key_position + key.size() + 3;
+        if (begin < object.size() && object[begin] == '"') {
+            std::size_t end = object.find('"', begin + 1);
+            if (end == std::string::npos) return std::nullopt;
+            return object.substr(begin + 1, end - begin - 1);
+        }
+
+        std::size_t end = object.find_first_of(",}", begin);
+        if (end == std::string::npos) return std::nullopt;
+        return object.substr(begin, end - begin);
+    }
+}
+
+double ReportTolerances::getTolerance(const std::string &name) const {
+    double tolerance = default_tolerance;
+    std::size_t longest_prefix = 0;
+    for (const auto &[prefix, prefix_tolerance]: overrides) {
+        if (prefix.size() >= longest_prefix && name.starts_with(prefix)) {
+            tolerance = prefix_tolerance;
+            longest_prefix = prefix.size();
+        }
+    }
+    return tolerance;
+}
+
+void RunReport::add(const std::string &name, double value, MetricDirection direction) {
+    _metrics.push_back({name, value, direction});
+}
+
+void RunReport::addDistribution(const std::string &name, const DistributionSummary &summary) {
+    add(name + ".count", static_cast<double>(summary.count), MetricDirection::none);
+    // single samples, too noisy to gate a release on
+    add(name + ".min", summary.min, MetricDirection::none);
+    add(name + ".mean", summary.mean);
+    add(name + ".p50", summary.p50);
+    add(name + ".p90", summary.p90);
+    add(name + ".p99", summary.p99);
+    add(name + ".max", summary.max, MetricDirection::none);
+}
+
+const std::vector<ReportMetric> &RunReport::getMetrics() const {
+    return _metrics;
+}
+
+const ReportMetric *RunReport::find(const std::string &name) const {
+    auto it = std::find_if(_metrics.begin(), _metrics.end(),
+                           [&name](const ReportMetric &metric) { return metric.name == name; });
+    return it == _metrics.end() ? nullptr : &*it;
+}
+
+void RunReport::writeJson(std::ostream &stream) const {
+    stream << R"({"metrics":[)" << std::endl;
+    for (std::size_t i = 0; i < _metrics.size(); i++) {
+        const ReportMetric &metric = _metrics[i];
+        stream << R"({"name":")" << metric.name << R"(","value":)" << std::setprecision(9) << metric.value
+               << R"(,"direction":")" << getDirectionName(metric.direction) << "\"}"
+               << (i + 1 < _metrics.size() ? "," : "") << std::endl;
+    }
+    stream << "]}" << std::endl;
+}
+
+void RunReport::writeCsv(std::ostream &stream) const {
+    stream << "name,value,direction" << std::endl;
+    for (const ReportMetric &metric: _metrics) {
+        stream << metric.name << "," << std::setprecision(9) << metric.value << ","
+               << getDirectionName(metric.direction) << std::endl;
+    }
+}
+
+std::optional<RunReport> RunReport::read(std::istream &stream) {
+    std::string text(std::istreambuf_iterator<char>(stream), {});
+
+    std::size_t first = text.find_first_not_of(" \t\r\n");
+    if (first == std::string::npos) return std::nullopt;
+
+    return text[first] == '{' ? readJson(text) : readCsv(text);
+}
+
+std::optional<RunReport> RunReport::readJson(const std::string &text) {
+    // only the layout written by writeJson, one flat object per metric
+    RunReport report;
+    std::size_t position = text.find(R"({"name":)");
+    while (position != std::string::npos) {
+        std::size_t end = text.find('}', position);
+        if (end == std::string::npos) return std::nullopt;
+
+        std::string object = text.substr(position, end - position + 1);
+        std::optional<std::string> name = findJsonValue(object, "name");
+        std::optional<std::string> value = findJsonValue(object, "value");
+        std::optional<std::string> direction = findJsonValue(object, "direction");
+        if (!name || !value || !direction) return std::nullopt;
+
+        std::optional<double> parsed_value = parseValue(*value);
+        std::optional<MetricDirection> parsed_direction = parseDirection(*direction);
+        if (!parsed_value || !parsed_direction) return std::nullopt;
+
+        report.add(*name, *parsed_value, *parsed_direction);
+        position = text.find(R"({"name":)", end);
+    }
+
+    if (report._metrics.empty()) return std::nullopt;
+    return report;
+}
+
+std::optional<RunReport> RunReport::readCsv(const std::string &text) {
+    RunReport report;
+    std::istringstream lines(text);
+    std::string line;
+
+    if (!std::getline(lines, line) || !line.starts_with("name,value,direction")) return std::nullopt;
+
+    while (std::getline(lines, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line.empty()) continue;
+
+        std::size_t first_comma = line.find(',');
+        std::size_t second_comma = line.find(',', first_comma + 1);
+        if (first_comma == std::string::npos || second_comma == std::string::npos) return std::nullopt;
+
+        std::optional<double> value = parseValue(line.substr(first_comma + 1, second_comma - first_comma - 1));
+        std::optional<MetricDirection> direction = parseDirection(std::string_view(line).substr(second_comma + 1));
+        if (!value || !direction) return std::nullopt;
+
+        report.add(line.substr(0, first_comma), *value, *direction);
+    }
+
+    if (report._metrics.empty()) return std::nullopt;
+    return report;
+}
+
+std::vector<MetricComparison> RunReport::compare(const RunReport &baseline, const RunReport &current,
+                                                 const ReportTolerances &tolerances) {
+    std::vector<MetricComparison> comparisons;
+    comparisons.reserve(baseline._metrics.size());
+
+    for (const ReportMetric &baseline_metric: baseline._metrics) {
+        MetricComparison comparison{baseline_metric.name, baseline_metric.value, 0,
+                                    tolerances.getTolerance(baseline_metric.name), baseline_metric.direction};
+
+        const ReportMetric *current_metric = current.find(baseline_metric.name);
+        if (!current_metric) {
+            comparison.missing = true;
+            comparison.regressed = true;
+            comparisons.push_back(comparison);
+            continue;
+        }
+
+        comparison.current = current_metric->value;
+
+        // relative to the baseline, a baseline of 0 allows no change at all in the worse direction
+        double allowed_change = std::abs(baseline_metric.value) * comparison.tolerance;
+        switch (baseline_metric.direction) {
+            case MetricDirection::lower_is_better:
+                comparison.regressed = comparison.current > baseline_metric.value + allowed_change;
+                break;
+            case MetricDirection::higher_is_better:
+                comparison.regressed = comparison.current < baseline_metric.value - allowed_change;
+                break;
+            case MetricDirection::none:
+                break;
+        }
+
+        comparisons.push_back(comparison);
+    }
+
+    return comparisons;
+}
@@ -0,0 +1,92 @@
+#ifndef GAMEENGINE_RUNREPORT_H
+#define GAMEENGINE_RUNREPORT_H
+
+
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Distribution.h"
+
+// which direction of a metric is a regression
+enum class MetricDirection {
+    lower_is_better,
+    higher_is_better,
+    // informational, never a regression
+    none
+};
+
+struct ReportMetric {
+    std::string name;
+    double value{0};
+    MetricDirection direction{MetricDirection::lower_is_better};
+};
+
+struct ReportTolerances {
+    // allowed relative change in the worse direction, the counts of entities and allocations barely change between
+    // runs of the same seed
+    double default_tolerance{0.1};
+    // metrics starting with the prefix use its tolerance instead, the longest prefix wins and later overrides win
+    // ties, the timings vary between runs of the same code by up to a third and their tail by up to double
+    std::vector<std::pair<std::string, double>> overrides{
+            {"tick_ms.",      0.5},
+            {"tick_ms.p99",   1.0},
+            {"frame_ms.",     0.5},
+            {"frame_ms.p99",  1.0},
+            {"ticks_per_sec", 0.35},
+    };
+
+    double getTolerance(const std::string &name) const;
+};
+
+struct MetricComparison {
+    std::string name;
+    double baseline{0};
+    double current{0};
+    double tolerance{0};
+    MetricDirection direction{MetricDirection::lower_is_better};
+    // the metric is in the baseline but not in the current report
+    bool missing{false};
+    bool regressed{false};
+};
+
+// flat list of named metrics of a run, written as json or csv so a release check can compare it with a baseline
+class RunReport {
+private:
+    std::vector<ReportMetric> _metrics;
+
+public:
+    RunReport() = default;
+
+    void add(const std::string &name, double value, MetricDirection direction = MetricDirection::lower_is_better);
+
+    // adds name.count, name.min, name.mean, name.p50, name.p90, name.p99 and name.max
+    void addDistribution(const std::string &name, const DistributionSummary &summary);
+
+    const std::vector<ReportMetric> &getMetrics() const;
+
+    const ReportMetric *find(const std::string &name) const;
+
+    // one metric per line
+    void writeJson(std::ostream &stream) const;
+
+    // name,value,direction with a header line
+    void writeCsv(std::ostream &stream) const;
+
+    // reads either format written above, std::nullopt if the input isn't a report
+    static std::optional<RunReport> read(std::istream &stream);
+
+    // compares every metric of the baseline, metrics that only exist in the current report are ignored
+    static std::vector<MetricComparison> compare(const RunReport &baseline, const RunReport &current,
+                                                 const ReportTolerances &tolerances);
+
+private:
+    static std::optional<RunReport> readJson(const std::string &text);
+
+    static std::optional<RunReport> readCsv(const std::string &text);
+};
+
+
+#endif //GAMEENGINE_RUNREPORT_H
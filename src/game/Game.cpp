@@ -1,9 +1,11 @@
 #include "Game.h"
 
+#include <iomanip>
+
 Game::Game()
         : _screen_width(constants::screen_width), _screen_height(constants::screen_height),
           _running(true), _entity_view_creator(new EntityViewCreator), _entity_audio_creator(new EntityAudioCreator),
-          _draw_hitbox(false) {
+          _draw_hitbox(false), _print_census(false), _printed_census_sample(0) {
     _window = std::make_unique<sf::RenderWindow>(sf::VideoMode(_screen_width, _screen_height), "GameEngine");
 
     // coreAPI initialize
@@ -23,38 +25,108 @@ void Game::run() {
         // coreAPI physicsUpdate
         _world->update();
 
+        if (_print_census && _world->getCensus().getSampleCount() != _printed_census_sample) {
+            printCensus();
+        }
+
         // sfml draw
         draw();
     }
 }
 
+const RenderStats &Game::getRenderStats() const {
+    return _render_stats;
+}
+
 void Game::draw() {
     _window->clear(sf::Color(127, 128, 118));
 
-    // render entity views
-    for (const auto &entity_sprite_view: _entity_view_creator->getEntitySpriteViews()) {
-        _window->draw(entity_sprite_view->getSprite());
+    // camera transform, computed once per frame instead of projecting every entity
+    std::shared_ptr<Camera> camera = _world->getCamera();
+    Vector2f projection_scale = camera->getProjectionScale();
+    Vector2f projection_offset = camera->getProjectionOffset();
+    sf::Transform camera_transform;
+    camera_transform.translate(projection_offset.x, projection_offset.y);
+    camera_transform.scale(projection_scale.x, projection_scale.y);
+
+    // views outside of the camera bounds are culled, screen space sprites are always visible
+    Vector2f camera_x_bounds = camera->getXBounderies();
+    Vector2f camera_y_bounds = camera->getYBounderies();
+    _render_stats = {};
+
+    // render entity views, the particles are drawn in between at their layer
+    std::vector<std::shared_ptr<EntityView>> entity_views = _entity_view_creator->getEntityViews();
+    std::size_t particle_draw_index = _entity_view_creator->getParticleDrawIndex();
+    for (std::size_t i = 0; i <= entity_views.size(); i++) {
+        if (i == particle_draw_index) {
+            // every particle in one draw call
+            _render_stats.drawn_particles = _entity_view_creator->getParticleRenderer().draw(
+                    *_window, sf::RenderStates(camera_transform), camera_x_bounds, camera_y_bounds);
+            if (_render_stats.drawn_particles > 0) _render_stats.draw_calls++;
+        }
+        if (i == entity_views.size()) break;
+
+        const std::shared_ptr<EntityView> &entity_view = entity_views[i];
+        if (entity_view->isScreenSpace()) {
+            entity_view->draw(*_window, sf::RenderStates::Default);
+        } else if (entity_view->isInBounds(camera_x_bounds, camera_y_bounds)) {
+            entity_view->draw(*_window, sf::RenderStates(camera_transform));
+        } else {
+            _render_stats.culled_views++;
+            continue;
+        }
+        _render_stats.drawn_views++;
+        _render_stats.draw_calls++;
 
         if (_draw_hitbox) {
             // debug information
-            _window->draw(entity_sprite_view->getHitbox());
-            _window->draw(entity_sprite_view->getRays());
+            _window->draw(entity_view->getHitbox());
+            _window->draw(entity_view->getRays());
+            _render_stats.draw_calls += 2;
         }
     }
     for (const auto &entity_text_view: _entity_view_creator->getEntityTextViews()) {
-        sf::Text new_text = entity_text_view->getText();
-        _window->draw(new_text);
+        if (!entity_text_view->isInBounds(camera_x_bounds, camera_y_bounds)) {
+            _render_stats.culled_views++;
+            continue;
+        }
+        _render_stats.drawn_views++;
+        _render_stats.draw_calls++;
+
+        entity_text_view->draw(*_window, sf::RenderStates::Default);
 
         if (_draw_hitbox) {
             // debug information
             _window->draw(entity_text_view->getHitbox());
             _window->draw(entity_text_view->getRays());
+            _render_stats.draw_calls += 2;
         }
     }
 
+    // drawn on top of everything in window coordinates
+    _perf_overlay.update(*_world, _render_stats);
+    _perf_overlay.draw(*_window);
+
     _window->display();
 }
 
+void Game::printCensus() {
+    const Census &census = _world->getCensus();
+    _printed_census_sample = census.getSampleCount();
+
+    std::cout << "census " << _printed_census_sample << std::endl;
+    for (const CensusEntry &entry: census.getEntries()) {
+        if (entry.count == 0 && entry.bytes == 0) continue;
+
+        std::cout << std::left << std::setw(20) << entry.name << std::right << std::setw(8) << entry.count
+                  << std::setw(12) << entry.bytes << std::endl;
+    }
+
+    CensusEntry total = census.getTotal();
+    std::cout << std::left << std::setw(20) << total.name << std::right << std::setw(8) << total.count
+              << std::setw(12) << total.bytes << std::endl;
+}
+
 void Game::handleEvents() {
     // coreAPI handle events (add to eventmanager)
 
@@ -225,6 +297,18 @@ void Game::handleKeyboardInput(const sf::Event &event, bool pressed) {
             _world->getUserInputMap()->slash = pressed;
             break;
 
+        case sf::Keyboard::F2:
+            if (pressed) {
+                _perf_overlay.toggle();
+            }
+            break;
+
+        case sf::Keyboard::F3:
+            if (pressed) {
+                _print_census = !_print_census;
+            }
+            break;
+
         default:
             break;
     }
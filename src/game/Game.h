@@ -6,6 +6,7 @@
 #include "constants.h"
 #include "game/entity_view/EntityViewCreator.h"
 #include "game/audio/EntityAudioCreator.h"
+#include "game/debug/PerfOverlay.h"
 #include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
 #include <iostream>
@@ -24,6 +25,11 @@ private:
     std::shared_ptr<EntityAudioCreator> _entity_audio_creator;
 
     bool _draw_hitbox;
+    // prints every new census sample of the world
+    bool _print_census;
+    unsigned long long _printed_census_sample;
+    RenderStats _render_stats;
+    PerfOverlay _perf_overlay;
     bool _mouse_button_left_clicked;
 
 public:
@@ -33,11 +39,15 @@ public:
 
     void run();
 
+    const RenderStats &getRenderStats() const;
+
 private:
     void draw();
 
     void handleEvents();
 
+    void printCensus();
+
     void handleKeyboardInput(const sf::Event &event, bool pressed);
 
     void handleMouseInput(const sf::Event &event, bool pressed);
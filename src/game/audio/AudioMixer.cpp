@@ -0,0 +1,110 @@
+#include "AudioMixer.h"
+
+AudioMixer::AudioMixer(unsigned int voice_count) : _voices(voice_count), _stolen_voices(0), _rejected_sounds(0) {
+
+}
+
+unsigned int AudioMixer::addSound(std::shared_ptr<sf::SoundBuffer> sound_buffer, unsigned int priority) {
+    _sound_buffers.push_back(std::move(sound_buffer));
+    _sound_priorities.push_back(priority);
+
+    return _sound_buffers.size() - 1;
+}
+
+VoiceHandle AudioMixer::playSound(unsigned int sound_id, unsigned int volume, bool loop) {
+    if (sound_id >= _sound_buffers.size() || _voices.empty()) return {};
+
+    unsigned int priority = _sound_priorities[sound_id];
+
+    // free voice, otherwise the lowest priority and quietest one
+    int voice_index = -1;
+    for (unsigned int i = 0; i < _voices.size(); i++) {
+        const Voice &voice = _voices[i];
+
+        if (voice.sound.getStatus() != sf::SoundSource::Playing) {
+            voice_index = static_cast<int>(i);
+            break;
+        }
+
+        if (voice_index == -1 || voice.priority < _voices[voice_index].priority ||
+            (voice.priority == _voices[voice_index].priority && voice.volume < _voices[voice_index].volume)) {
+            voice_index = static_cast<int>(i);
+        }
+    }
+
+    Voice &voice = _voices[voice_index];
+
+    if (voice.sound.getStatus() == sf::SoundSource::Playing) {
+        // never steal from a more important or louder voice
+        if (voice.priority > priority || (voice.priority == priority && voice.volume > volume)) {
+            _rejected_sounds++;
+            return {};
+        }
+
+        voice.sound.stop();
+        _stolen_voices++;
+    }
+
+    voice.priority = priority;
+    voice.volume = volume;
+    voice.generation++;
+
+    voice.sound.setBuffer(*_sound_buffers[sound_id]);
+    voice.sound.setLoop(loop);
+    voice.sound.setVolume(static_cast<float>(volume));
+    voice.sound.play();
+
+    return {voice_index, voice.generation};
+}
+
+void AudioMixer::stop(const VoiceHandle &voice_handle) {
+    Voice *voice = getVoice(voice_handle);
+    if (voice) voice->sound.stop();
+}
+
+void AudioMixer::setVolume(const VoiceHandle &voice_handle, unsigned int volume) {
+    Voice *voice = getVoice(voice_handle);
+    if (!voice) return;
+
+    voice->volume = volume;
+    voice->sound.setVolume(static_cast<float>(volume));
+}
+
+bool AudioMixer::isPlaying(const VoiceHandle &voice_handle) const {
+    const Voice *voice = getVoice(voice_handle);
+    return voice && voice->sound.getStatus() == sf::SoundSource::Playing;
+}
+
+unsigned int AudioMixer::getVoiceCount() const {
+    return _voices.size();
+}
+
+unsigned int AudioMixer::getActiveVoiceCount() const {
+    unsigned int active_voices = 0;
+    for (const auto &voice: _voices) {
+        if (voice.sound.getStatus() == sf::SoundSource::Playing) active_voices++;
+    }
+    return active_voices;
+}
+
+unsigned long long AudioMixer::getStolenVoices() const {
+    return _stolen_voices;
+}
+
+unsigned long long AudioMixer::getRejectedSounds() const {
+    return _rejected_sounds;
+}
+
+AudioMixer::Voice *AudioMixer::getVoice(const VoiceHandle &voice_handle) {
+    if (voice_handle.index < 0 || voice_handle.index >= static_cast<int>(_voices.size())) return nullptr;
+
+    Voice &voice = _voices[voice_handle.index];
+    return voice.generation == voice_handle.generation ? &voice : nullptr;
+}
+
+const AudioMixer::Voice *AudioMixer::getVoice(const VoiceHandle &voice_handle) const {
+    if (voice_handle.index < 0 || voice_handle.index >= static_cast<int>(_voices.size())) return nullptr;
+
+    const Voice &voice = _voices[voice_handle.index];
+    return voice.generation == voice_handle.generation ? &voice : nullptr;
+}
@@ -0,0 +1,63 @@
+#ifndef GAMEENGINE_AUDIOMIXER_H
+#define GAMEENGINE_AUDIOMIXER_H
+
+
+#include <SFML/Audio/Sound.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <memory>
+#include <vector>
+
+struct VoiceHandle {
+    int index{-1};
+    unsigned int generation{0};
+};
+
+// fixed pool of sound voices shared by every entity audio, when the pool is full the least important voice
+// (lowest priority, then quietest i.e. furthest away) is stolen
+class AudioMixer {
+private:
+    struct Voice {
+        sf::Sound sound;
+        unsigned int priority{0};
+        unsigned int volume{0};
+        // invalidates the handles of a stolen voice
+        unsigned int generation{0};
+    };
+
+    std::vector<Voice> _voices;
+
+    std::vector<std::shared_ptr<sf::SoundBuffer>> _sound_buffers;
+    std::vector<unsigned int> _sound_priorities;
+
+    unsigned long long _stolen_voices;
+    unsigned long long _rejected_sounds;
+
+public:
+    explicit AudioMixer(unsigned int voice_count);
+
+    unsigned int addSound(std::shared_ptr<sf::SoundBuffer> sound_buffer, unsigned int priority);
+
+    VoiceHandle playSound(unsigned int sound_id, unsigned int volume, bool loop = false);
+
+    void stop(const VoiceHandle &voice_handle);
+
+    void setVolume(const VoiceHandle &voice_handle, unsigned int volume);
+
+    bool isPlaying(const VoiceHandle &voice_handle) const;
+
+    unsigned int getVoiceCount() const;
+
+    unsigned int getActiveVoiceCount() const;
+
+    unsigned long long getStolenVoices() const;
+
+    unsigned long long getRejectedSounds() const;
+
+private:
+    Voice *getVoice(const VoiceHandle &voice_handle);
+
+    const Voice *getVoice(const VoiceHandle &voice_handle) const;
+};
+
+
+#endif //GAMEENGINE_AUDIOMIXER_H
@@ -1,9 +1,9 @@
 #include "EntityAudio.h"
 
-EntityAudio::EntityAudio(std::weak_ptr<Entity> entity, std::vector<std::shared_ptr<sf::SoundBuffer>> sound_buffers,
-                         std::vector<std::string> music_files) :
-        _entity(std::move(entity)), _sound_buffers(std::move(sound_buffers)), _music_files(std::move(music_files)),
-        _loop(false), _finish(false) {
+EntityAudio::EntityAudio(std::weak_ptr<Entity> entity, std::shared_ptr<AudioMixer> audio_mixer,
+                         std::vector<std::shared_ptr<const MusicStream>> music_streams) :
+        _entity(std::move(entity)), _audio_mixer(std::move(audio_mixer)), _music_streams(std::move(music_streams)),
+        _current_music_id(-1), _volume(100), _loop(false), _finish(false) {
 
 }
 
@@ -22,9 +22,9 @@ void EntityAudio::handleEvent(const unsigned int &event, const unsigned int &cha
         _loop = event != 0;
     } else if (channel == 7) {
         if (event == 0) {
-            _sound.stop();
+            stopSound();
         } else {
-            _music.stop();
+            stopMusic();
         }
     } else if (channel == 8) {
         setVolume(event);
@@ -32,24 +32,67 @@ void EntityAudio::handleEvent(const unsigned int &event, const unsigned int &cha
 }
 
 void EntityAudio::playSound(unsigned int sound_id) {
-    if (_sound.getStatus() == 2 && _finish) return;
+    if (_audio_mixer->isPlaying(_voice) && _finish) return;
 
-    _sound.setBuffer(*_sound_buffers[sound_id]);
-    _sound.setLoop(_loop);
-    _sound.play();
+    // an entity only has one sound at a time
+    _audio_mixer->stop(_voice);
+    _voice = _audio_mixer->playSound(sound_id, _volume, _loop);
+}
+
+void EntityAudio::stopSound() {
+    _audio_mixer->stop(_voice);
+    _voice = {};
 }
 
 void EntityAudio::playMusic(unsigned int music_id) {
-    if (_music.getStatus() == 2 && _finish) return;
+    if (isMusicPlaying() && _finish) return;
+
+    const std::shared_ptr<const MusicStream> &music_stream = _music_streams[music_id];
+
+    // restarting the current track is only a seek
+    if (static_cast<int>(music_id) != _current_music_id) {
+        stopMusic();
+
+        if (music_stream->buffer) {
+            if (!_music_loop) _music_loop = std::make_unique<sf::Sound>();
+            _music_loop->setBuffer(*music_stream->buffer);
+            _music_loop->setVolume(static_cast<float>(_volume));
+        } else {
+            if (!_music) _music = std::make_unique<sf::Music>();
+            if (!_music->openFromMemory(music_stream->file_data.data(), music_stream->file_data.size())) {
+                return; // todo: exception
+            }
+            _music->setVolume(static_cast<float>(_volume));
+        }
 
-    if (!_music.openFromFile(_music_files[music_id]))
-        return; // todo: exception
+        _current_music_id = static_cast<int>(music_id);
+    }
+
+    if (music_stream->buffer) {
+        _music_loop->setLoop(_loop);
+        _music_loop->setPlayingOffset(sf::Time::Zero);
+        _music_loop->play();
+    } else {
+        _music->setLoop(_loop);
+        _music->setPlayingOffset(sf::Time::Zero);
+        _music->play();
+    }
+}
 
-    _music.setLoop(_loop);
-    _music.play();
+void EntityAudio::stopMusic() {
+    if (_music) _music->stop();
+    if (_music_loop) _music_loop->stop();
+}
+
+bool EntityAudio::isMusicPlaying() const {
+    return (_music && _music->getStatus() == sf::SoundSource::Playing) ||
+           (_music_loop && _music_loop->getStatus() == sf::SoundSource::Playing);
 }
 
 void EntityAudio::setVolume(unsigned int volume) {
-    _sound.setVolume(static_cast<float>(volume));
-    _music.setVolume(static_cast<float>(volume));
+    _volume = volume;
+
+    _audio_mixer->setVolume(_voice, volume);
+    if (_music) _music->setVolume(static_cast<float>(volume));
+    if (_music_loop) _music_loop->setVolume(static_cast<float>(volume));
 }
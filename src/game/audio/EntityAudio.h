@@ -9,23 +9,32 @@
 #include <utility>
 #include "core/observer-pattern-interface/IObserver.h"
 #include "core/entities/Entity.h"
+#include "MusicStream.h"
+#include "AudioMixer.h"
 
 class EntityAudio : public IObserver {
 private:
     std::weak_ptr<Entity> _entity;
 
-    std::vector<std::shared_ptr<sf::SoundBuffer>> _sound_buffers;
-    std::vector<std::string> _music_files;
+    // sounds are played on the shared voice pool
+    std::shared_ptr<AudioMixer> _audio_mixer;
+    VoiceHandle _voice;
 
-    sf::Sound _sound;
-    sf::Music _music;
+    std::vector<std::shared_ptr<const MusicStream>> _music_streams;
+
+    // streamed music and preloaded short loops, only allocated once the entity plays music
+    std::unique_ptr<sf::Music> _music;
+    std::unique_ptr<sf::Sound> _music_loop;
+    int _current_music_id;
+
+    unsigned int _volume;
 
     bool _loop;
     bool _finish;
 
 public:
-    EntityAudio(std::weak_ptr<Entity> entity, std::vector<std::shared_ptr<sf::SoundBuffer>> sound_buffers,
-                std::vector<std::string> music_files);
+    EntityAudio(std::weak_ptr<Entity> entity, std::shared_ptr<AudioMixer> audio_mixer,
+                std::vector<std::shared_ptr<const MusicStream>> music_streams);
 
     void handleEvent() override;
 
@@ -33,8 +42,14 @@ public:
 
     void playSound(unsigned int sound_id);
 
+    void stopSound();
+
     void playMusic(unsigned int music_id);
 
+    void stopMusic();
+
+    bool isMusicPlaying() const;
+
     void setVolume(unsigned int volume);
 };
 
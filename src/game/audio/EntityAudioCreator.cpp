@@ -1,25 +1,59 @@
 #include "EntityAudioCreator.h"
 
-unsigned int EntityAudioCreator::loadSound(const std::string &filename) {
+#include <fstream>
+#include <iterator>
+
+EntityAudioCreator::EntityAudioCreator() : _audio_mixer(std::make_shared<AudioMixer>(constants::audio_voice_count)) {
+
+}
+
+unsigned int EntityAudioCreator::loadSound(const std::string &filename, unsigned int priority) {
     std::shared_ptr<sf::SoundBuffer> new_sound_buffer = std::make_shared<sf::SoundBuffer>();
     if (!new_sound_buffer->loadFromFile(filename)) {
         std::cout << "couldn't load sound from file" << std::endl;
         // todo exception
     }
 
-    _sound_buffers.push_back(new_sound_buffer);
+    return _audio_mixer->addSound(new_sound_buffer, priority);
+}
 
-    return _sound_buffers.size() - 1;
+void EntityAudioCreator::playSound(unsigned int sound_id, unsigned int volume) {
+    _audio_mixer->playSound(sound_id, volume);
 }
 
 unsigned int EntityAudioCreator::loadMusic(const std::string &filename) {
-    _music_files.push_back(filename);
+    std::shared_ptr<MusicStream> new_music_stream = std::make_shared<MusicStream>();
+    new_music_stream->filename = filename;
+
+    // read the encoded file once, entity audios stream it from memory
+    std::ifstream file(filename, std::ios::binary);
+    if (file) {
+        new_music_stream->file_data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    } else {
+        std::cout << "couldn't load music from file" << std::endl;
+        // todo exception
+    }
+
+    // short loops are decoded up front so restarting them is only a seek in a buffer
+    sf::InputSoundFile music_file;
+    if (!new_music_stream->file_data.empty() &&
+        music_file.openFromMemory(new_music_stream->file_data.data(), new_music_stream->file_data.size()) &&
+        music_file.getDuration().asSeconds() <= constants::music_preload_max_duration) {
+        std::shared_ptr<sf::SoundBuffer> new_music_buffer = std::make_shared<sf::SoundBuffer>();
+
+        if (new_music_buffer->loadFromMemory(new_music_stream->file_data.data(),
+                                             new_music_stream->file_data.size())) {
+            new_music_stream->buffer = new_music_buffer;
+        }
+    }
 
-    return _music_files.size() - 1;
+    _music_streams.push_back(new_music_stream);
+
+    return _music_streams.size() - 1;
 }
 
 void EntityAudioCreator::createEntityAudio(std::shared_ptr<Entity> entity) {
-    std::shared_ptr<EntityAudio> new_entity_audio(new EntityAudio(entity, _sound_buffers, _music_files));
+    std::shared_ptr<EntityAudio> new_entity_audio(new EntityAudio(entity, _audio_mixer, _music_streams));
     std::weak_ptr<EntityAudio> new_entity_audio_weak = new_entity_audio;
 
     _entity_audios.push_back(new_entity_audio_weak);
@@ -28,3 +62,7 @@ void EntityAudioCreator::createEntityAudio(std::shared_ptr<Entity> entity) {
 
     entity->replayAudio();
 }
+
+const AudioMixer &EntityAudioCreator::getAudioMixer() const {
+    return *_audio_mixer;
+}
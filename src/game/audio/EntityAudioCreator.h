@@ -8,22 +8,31 @@
 #include <memory>
 #include "core/audio/IEntityAudioCreator.h"
 #include "EntityAudio.h"
+#include "MusicStream.h"
+#include "AudioMixer.h"
+#include "game/constants.h"
 
 class EntityAudioCreator : public IEntityAudioCreator {
 private:
-    std::vector<std::shared_ptr<sf::SoundBuffer>> _sound_buffers;
-    std::vector<std::string> _music_files;
+    // fixed voice pool, owns the sound buffers
+    std::shared_ptr<AudioMixer> _audio_mixer;
+    // music stream cache, shared with every entity audio
+    std::vector<std::shared_ptr<const MusicStream>> _music_streams;
 
     std::vector<std::weak_ptr<EntityAudio>> _entity_audios;
 
 public:
-    EntityAudioCreator() = default;
+    EntityAudioCreator();
 
-    unsigned int loadSound(const std::string &filename) override;
+    unsigned int loadSound(const std::string &filename, unsigned int priority) override;
+
+    void playSound(unsigned int sound_id, unsigned int volume) override;
 
     unsigned int loadMusic(const std::string &filename) override;
 
     void createEntityAudio(std::shared_ptr<Entity> entity) override;
+
+    const AudioMixer &getAudioMixer() const;
 };
 
 
@@ -0,0 +1,22 @@
+#ifndef GAMEENGINE_MUSICSTREAM_H
+#define GAMEENGINE_MUSICSTREAM_H
+
+
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+// a music track kept in memory, (re)starting it never touches the filesystem
+struct MusicStream {
+    std::string filename;
+
+    // encoded file, streamed from memory by sf::Music
+    std::vector<char> file_data;
+
+    // fully decoded track, only for short loops
+    std::shared_ptr<sf::SoundBuffer> buffer;
+};
+
+
+#endif //GAMEENGINE_MUSICSTREAM_H
@@ -3,4 +3,9 @@
 //const unsigned int constants::screen_width = 1280;
 //const unsigned int constants::screen_height = 720;
 const unsigned int constants::screen_width = 800;
-const unsigned int constants::screen_height = 1200;
\ No newline at end of file
+const unsigned int constants::screen_height = 1200;
+
+const float constants::music_preload_max_duration = 30.f;
+const unsigned int constants::audio_voice_count = 32;
+const std::size_t constants::texture_budget = 64 * 1024 * 1024;
+const float constants::perf_overlay_refresh_interval = 0.25f;
@@ -1,9 +1,23 @@
 #ifndef GAMEENGINE_GAMECONSTANTS_H
 #define GAMEENGINE_GAMECONSTANTS_H
 
+#include <cstddef>
+
 namespace constants {
     extern const unsigned int screen_width;
     extern const unsigned int screen_height;
+
+    // music tracks up to this length (seconds) are decoded into memory instead of streamed
+    extern const float music_preload_max_duration;
+
+    // size of the shared sound voice pool, sfml can only play a limited amount of sounds at once
+    extern const unsigned int audio_voice_count;
+
+    // gpu memory (bytes) of the resident texture groups, unused groups are evicted above it
+    extern const std::size_t texture_budget;
+
+    // seconds between rebuilds of the performance overlay text
+    extern const float perf_overlay_refresh_interval;
 }
 
 #endif // GAMEENGINE_GAMECONSTANTS_H
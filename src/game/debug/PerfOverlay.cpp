@@ -0,0 +1,104 @@
+#include "PerfOverlay.h"
+
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include "game/constants.h"
+
+PerfOverlay::PerfOverlay() : _visible(false), _buffer() {
+    if (!_font.loadFromFile("data/fonts/PT_Sans/PTSans-Regular.ttf")) {
+        // todo: exception handling
+        std::cout << "couldn't load font" << std::endl;
+    }
+
+    _text.setFont(_font);
+    _text.setCharacterSize(16);
+    _text.setFillColor(sf::Color::White);
+    _text.setOutlineColor(sf::Color::Black);
+    _text.setOutlineThickness(1.f);
+    _text.setPosition(8.f, 8.f);
+
+    reset();
+}
+
+bool PerfOverlay::isVisible() const {
+    return _visible;
+}
+
+void PerfOverlay::toggle() {
+    _visible = !_visible;
+    reset();
+}
+
+void PerfOverlay::update(const World &world, const RenderStats &render_stats) {
+    if (!_visible) return;
+
+    const ProfilerFrame &frame = world.getProfiler().getLastFrame();
+    float frame_time = world.getStopwatch()->getDeltaTime() * 1e3f;
+
+    _frames++;
+    _frame_time_sum += frame_time;
+    _frame_time_max = std::max(_frame_time_max, frame_time);
+    _ticks += frame.ticks;
+    _ticks_max = std::max(_ticks_max, frame.ticks);
+    for (unsigned int i = 0; i < _phase_duration_sum.size(); i++) {
+        _phase_duration_sum[i] += frame.phases[i].duration;
+    }
+    _phase_total_max = std::max(_phase_total_max, frame.getTotal().duration);
+
+    _refresh_time_passed += world.getStopwatch()->getDeltaTime();
+    if (_refresh_time_passed >= constants::perf_overlay_refresh_interval) {
+        refresh(world, render_stats);
+        reset();
+    }
+}
+
+void PerfOverlay::draw(sf::RenderTarget &target) const {
+    if (_visible) target.draw(_text);
+}
+
+void PerfOverlay::refresh(const World &world, const RenderStats &render_stats) {
+    const Stopwatch &stopwatch = *world.getStopwatch();
+    auto frames = static_cast<float>(_frames);
+    float update_duration = std::accumulate(_phase_duration_sum.begin(), _phase_duration_sum.end(), 0.f);
+    CensusEntry census_total = world.getCensus().getTotal();
+
+    // averages over the refresh interval, the maxima show the stutters in between
+    std::size_t length = 0;
+    append(length, "frame %.2f ms (max %.2f)  fps %.0f\n", _frame_time_sum / frames, _frame_time_max,
+           stopwatch.getAverageFps());
+    append(length, "ticks/frame %.2f (max %u)  backlog %.2f ticks  dropped %llu\n",
+           static_cast<float>(_ticks) / frames, _ticks_max, stopwatch.computeAlpha(), stopwatch.getDroppedTicks());
+    // simulated time per real time, the throughput of the simulation when the turbo is uncapped
+    float simulation_speed = static_cast<float>(_ticks) * stopwatch.getPhysicsDeltaTime() * 1e3f / _frame_time_sum;
+    if (stopwatch.getTurboUncapped()) {
+        append(length, "turbo uncapped at %u fps  simulation %.1fx\n", stopwatch.getTurboDisplayRate(),
+               simulation_speed);
+    } else if (stopwatch.isTurbo()) {
+        append(length, "turbo %u ticks/frame  simulation %.1fx\n", stopwatch.getTurboTicks(), simulation_speed);
+    } else {
+        append(length, "simulation %.2fx\n", simulation_speed);
+    }
+    append(length, "update %.3f ms (max %.3f)\n", update_duration / frames, _phase_total_max);
+    for (unsigned int i = 0; i < _phase_duration_sum.size(); i++) {
+        append(length, "  %-16s %.3f ms\n", Profiler::getPhaseName(static_cast<ProfilerPhase>(i)).data(),
+               _phase_duration_sum[i] / frames);
+    }
+    append(length, "draw calls %u  views %u (culled %u)  particles %u\n", render_stats.draw_calls,
+           render_stats.drawn_views, render_stats.culled_views, render_stats.drawn_particles);
+    append(length, "physics entities %u  census %u objects %.1f KiB", world.getPhysicsEntityCount(),
+           census_total.count, static_cast<double>(census_total.bytes) / 1024);
+
+    _text.setString(_buffer.data());
+}
+
+void PerfOverlay::reset() {
+    _refresh_time_passed = 0;
+    _frames = 0;
+    _frame_time_sum = 0;
+    _frame_time_max = 0;
+    _ticks = 0;
+    _ticks_max = 0;
+    _phase_duration_sum.fill(0);
+    _phase_total_max = 0;
+}
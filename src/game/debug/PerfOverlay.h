@@ -0,0 +1,67 @@
+#ifndef GAMEENGINE_PERFOVERLAY_H
+#define GAMEENGINE_PERFOVERLAY_H
+
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <SFML/Graphics.hpp>
+#include "core/World.h"
+
+// per frame draw counters
+struct RenderStats {
+    unsigned int drawn_views = 0;
+    unsigned int culled_views = 0;
+    unsigned int drawn_particles = 0;
+    unsigned int draw_calls = 0;
+};
+
+// frame statistics drawn on top of the game, the text is only rebuilt a few times per second into a fixed buffer
+// so the overlay itself barely shows up in the numbers it reports
+class PerfOverlay {
+private:
+    sf::Font _font;
+    sf::Text _text;
+    bool _visible;
+
+    // accumulated since the last refresh
+    float _refresh_time_passed;
+    unsigned int _frames;
+    float _frame_time_sum;
+    float _frame_time_max;
+    unsigned int _ticks;
+    unsigned int _ticks_max;
+    std::array<float, static_cast<unsigned int>(ProfilerPhase::count)> _phase_duration_sum;
+    float _phase_total_max;
+
+    std::array<char, 1024> _buffer;
+
+public:
+    PerfOverlay();
+
+    bool isVisible() const;
+
+    void toggle();
+
+    // called once per frame after the world update and the draw of the scene
+    void update(const World &world, const RenderStats &render_stats);
+
+    void draw(sf::RenderTarget &target) const;
+
+private:
+    void refresh(const World &world, const RenderStats &render_stats);
+
+    void reset();
+
+    // formats into the buffer after length, the text is cut off when the buffer is full
+    template<typename... Args>
+    void append(std::size_t &length, const char *format, Args... args) {
+        if (length >= _buffer.size() - 1) return;
+
+        int written = std::snprintf(_buffer.data() + length, _buffer.size() - length, format, args...);
+        if (written > 0) length = std::min(length + static_cast<std::size_t>(written), _buffer.size() - 1);
+    }
+};
+
+
+#endif //GAMEENGINE_PERFOVERLAY_H
@@ -0,0 +1,81 @@
+#include "ParticleRenderer.h"
+
+#include <algorithm>
+
+ParticleRenderer::ParticleRenderer() : _vertices(sf::Quads) {
+
+}
+
+void ParticleRenderer::loadEffect(ParticleEffect effect, const std::vector<std::string> &texture_filenames) {
+    EffectFrames &effect_frames = _effect_frames[toIndex(effect)];
+    effect_frames.count = 0;
+
+    for (const auto &texture_filename: texture_filenames) {
+        unsigned int region = _atlas.addImage(texture_filename);
+        if (effect_frames.count == 0) effect_frames.first_region = region;
+        effect_frames.count++;
+    }
+}
+
+void ParticleRenderer::setParticleSystem(std::shared_ptr<const ParticleSystem> particle_system) {
+    _particle_system = std::move(particle_system);
+}
+
+unsigned int ParticleRenderer::draw(sf::RenderTarget &target, const sf::RenderStates &states,
+                                    const Vector2f &x_bounds, const Vector2f &y_bounds) {
+    if (!_particle_system || _particle_system->getCount() == 0) return 0;
+
+    std::span<const float> x = _particle_system->getX();
+    std::span<const float> y = _particle_system->getY();
+    std::span<const float> size = _particle_system->getSize();
+    std::span<const float> age = _particle_system->getAge();
+    std::span<const float> lifetime = _particle_system->getLifetime();
+    std::span<const ParticleEffect> effect = _particle_system->getEffect();
+
+    // the vertex array keeps its memory between frames
+    _vertices.resize(x.size() * 4);
+
+    unsigned int drawn_particles = 0;
+    for (std::size_t i = 0; i < x.size(); i++) {
+        float half_size = size[i] / 2;
+        if (x[i] + half_size < x_bounds.x || x[i] - half_size > x_bounds.y ||
+            y[i] + half_size < y_bounds.x || y[i] - half_size > y_bounds.y) {
+            continue;
+        }
+
+        const EffectFrames &effect_frames = _effect_frames[toIndex(effect[i])];
+        if (effect_frames.count == 0) continue;
+
+        // the frames are played once over the lifetime
+        auto frame = static_cast<unsigned int>(age[i] / lifetime[i] * static_cast<float>(effect_frames.count));
+        frame = std::min(frame, effect_frames.count - 1);
+        const sf::IntRect &region = _atlas.getRegion(effect_frames.first_region + frame);
+
+        float left = static_cast<float>(region.left);
+        float top = static_cast<float>(region.top);
+        float right = left + static_cast<float>(region.width);
+        float bottom = top + static_cast<float>(region.height);
+
+        // core y points up, the top of the texture goes to the highest y
+        sf::Vertex *quad = &_vertices[drawn_particles * 4];
+        quad[0].position = {x[i] - half_size, y[i] + half_size};
+        quad[1].position = {x[i] + half_size, y[i] + half_size};
+        quad[2].position = {x[i] + half_size, y[i] - half_size};
+        quad[3].position = {x[i] - half_size, y[i] - half_size};
+
+        quad[0].texCoords = {left, top};
+        quad[1].texCoords = {right, top};
+        quad[2].texCoords = {right, bottom};
+        quad[3].texCoords = {left, bottom};
+
+        drawn_particles++;
+    }
+
+    if (drawn_particles == 0) return 0;
+
+    sf::RenderStates particle_states = states;
+    particle_states.texture = &_atlas.getTexture();
+    target.draw(&_vertices[0], drawn_particles * 4, sf::Quads, particle_states);
+
+    return drawn_particles;
+}
@@ -0,0 +1,42 @@
+#ifndef GAMEENGINE_PARTICLERENDERER_H
+#define GAMEENGINE_PARTICLERENDERER_H
+
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include "core/effects/ParticleSystem.h"
+#include "TextureAtlas.h"
+
+// draws every live particle as a textured quad of one vertex array, the frames of all effects share an atlas
+class ParticleRenderer {
+private:
+    struct EffectFrames {
+        unsigned int first_region = 0;
+        unsigned int count = 0;
+    };
+
+    std::shared_ptr<const ParticleSystem> _particle_system;
+
+    TextureAtlas _atlas;
+    std::array<EffectFrames, idCount<ParticleEffect>()> _effect_frames;
+
+    sf::VertexArray _vertices;
+
+public:
+    ParticleRenderer();
+
+    void loadEffect(ParticleEffect effect, const std::vector<std::string> &texture_filenames);
+
+    void setParticleSystem(std::shared_ptr<const ParticleSystem> particle_system);
+
+    // particles are in core coordinates, the states carry the camera transform, returns the drawn particles
+    unsigned int draw(sf::RenderTarget &target, const sf::RenderStates &states, const Vector2f &x_bounds,
+                      const Vector2f &y_bounds);
+};
+
+
+#endif //GAMEENGINE_PARTICLERENDERER_H
@@ -0,0 +1,105 @@
+#include "TextureAtlas.h"
+
+#include <algorithm>
+#include <iostream>
+
+TextureAtlas::TextureAtlas(unsigned int max_width) : _max_width(max_width), _packed(true) {
+
+}
+
+unsigned int TextureAtlas::addImage(const std::string &filename) {
+    sf::Image image;
+    if (!image.loadFromFile(filename)) {
+        std::cerr << "Couldn't load the texture \"" + filename + "\"" << std::endl;
+    }
+
+    return addImage(image);
+}
+
+unsigned int TextureAtlas::addImage(const sf::Image &image) {
+    _images.push_back(image);
+    _regions.emplace_back();
+    _packed = false;
+
+    return _regions.size() - 1;
+}
+
+const sf::IntRect &TextureAtlas::getRegion(unsigned int region_index) {
+    if (!_packed) pack();
+
+    return _regions.at(region_index);
+}
+
+const sf::Texture &TextureAtlas::getTexture() {
+    if (!_packed) pack();
+
+    return _texture;
+}
+
+void TextureAtlas::pack() {
+    // row by row, a new row starts when the next image doesn't fit anymore
+    unsigned int x = 0;
+    unsigned int y = 0;
+    unsigned int row_height = 0;
+    unsigned int width = 0;
+
+    for (unsigned int i = 0; i < _images.size(); i++) {
+        sf::Vector2u size = _images[i].getSize();
+        sf::Vector2u padded_size = {size.x + 2 * padding, size.y + 2 * padding};
+
+        if (x > 0 && x + padded_size.x > _max_width) {
+            x = 0;
+            y += row_height;
+            row_height = 0;
+        }
+
+        _regions[i] = sf::IntRect(static_cast<int>(x + padding), static_cast<int>(y + padding),
+                                  static_cast<int>(size.x), static_cast<int>(size.y));
+
+        x += padded_size.x;
+        row_height = std::max(row_height, padded_size.y);
+        width = std::max(width, x);
+    }
+
+    sf::Image atlas_image;
+    atlas_image.create(std::max(width, 1u), std::max(y + row_height, 1u), sf::Color(0, 0, 0, 0));
+    for (unsigned int i = 0; i < _images.size(); i++) {
+        atlas_image.copy(_images[i], _regions[i].left, _regions[i].top);
+        extrudeEdges(atlas_image, _images[i], _regions[i]);
+    }
+
+    _texture.loadFromImage(atlas_image);
+    _texture.setSmooth(true);
+    _packed = true;
+}
+
+void TextureAtlas::extrudeEdges(sf::Image &atlas_image, const sf::Image &image, const sf::IntRect &region) {
+    if (region.width == 0 || region.height == 0) return;
+
+    int left = region.left;
+    int top = region.top;
+    int right = region.left + region.width - 1;
+    int bottom = region.top + region.height - 1;
+    int last_x = region.width - 1;
+    int last_y = region.height - 1;
+
+    auto copy = [&atlas_image, &image](int dest_x, int dest_y, const sf::IntRect &source) {
+        atlas_image.copy(image, static_cast<unsigned int>(dest_x), static_cast<unsigned int>(dest_y), source);
+    };
+
+    for (int p = 1; p <= static_cast<int>(padding); p++) {
+        // sides
+        copy(left - p, top, {0, 0, 1, region.height});
+        copy(right + p, top, {last_x, 0, 1, region.height});
+        copy(left, top - p, {0, 0, region.width, 1});
+        copy(left, bottom + p, {0, last_y, region.width, 1});
+
+        // corners
+        for (int q = 1; q <= static_cast<int>(padding); q++) {
+            copy(left - p, top - q, {0, 0, 1, 1});
+            copy(right + p, top - q, {last_x, 0, 1, 1});
+            copy(left - p, bottom + q, {0, last_y, 1, 1});
+            copy(right + p, bottom + q, {last_x, last_y, 1, 1});
+        }
+    }
+}
@@ -0,0 +1,47 @@
+#ifndef GAMEENGINE_TEXTUREATLAS_H
+#define GAMEENGINE_TEXTUREATLAS_H
+
+
+#include <string>
+#include <vector>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+// packs images into rows of a single texture so they can be drawn with one draw call
+class TextureAtlas {
+public:
+    // pixels around every region, filled with the edge pixels of the image so smooth filtering at the edge of a
+    // region doesn't sample the neighbouring one
+    static constexpr unsigned int padding = 2;
+
+private:
+    unsigned int _max_width;
+
+    std::vector<sf::Image> _images;
+    std::vector<sf::IntRect> _regions;
+    sf::Texture _texture;
+    bool _packed;
+
+public:
+    explicit TextureAtlas(unsigned int max_width = 2048);
+
+    // returns the region index of the image
+    unsigned int addImage(const std::string &filename);
+
+    unsigned int addImage(const sf::Image &image);
+
+    // the atlas is (re)packed on first use after images were added
+    const sf::IntRect &getRegion(unsigned int region_index);
+
+    const sf::Texture &getTexture();
+
+private:
+    void pack();
+
+    // copies the outermost pixels of the image into the padding around its region
+    static void extrudeEdges(sf::Image &atlas_image, const sf::Image &image, const sf::IntRect &region);
+};
+
+
+#endif //GAMEENGINE_TEXTUREATLAS_H
@@ -1,12 +1,11 @@
 #include "EntitySpriteView.h"
 
-EntitySpriteView::EntitySpriteView(std::weak_ptr<Entity> entity,
-                                   std::shared_ptr<std::vector<sf::Texture>> texture_group)
-        : EntityView(std::move(entity)), _h_mirror(false), _texture_group(std::move(texture_group)),
-          _current_texture_index(0) {
+EntitySpriteView::EntitySpriteView(std::weak_ptr<Entity> entity, TextureHandle texture_group)
+        : EntityView(std::move(entity)), _h_mirror(false), _screen_space(false),
+          _texture_group(std::move(texture_group)), _current_texture_index(0) {
     std::shared_ptr<Entity> shared_entity = _entity.lock();
+    _screen_space = shared_entity->hasScreenSpaceView();
     setTexture(shared_entity->getCurrentTextureIndex(), shared_entity->isHorizontalMirror());
-    updateSprite();
 }
 
 void EntitySpriteView::handleEvent() {
@@ -22,38 +21,82 @@ void EntitySpriteView::handleEvent(const unsigned int &event, const unsigned int
 }
 
 void EntitySpriteView::setTexture(unsigned int texture_index, bool h_mirror) {
+    bool texture_changed = !_sprite.getTexture() || texture_index != _current_texture_index;
+    // same frame
+    if (!texture_changed && h_mirror == _h_mirror) return;
+
     _h_mirror = h_mirror;
     _current_texture_index = texture_index;
 
-    _sprite.setTexture(_texture_group->at(_current_texture_index), true);
-    _sprite.setOrigin(static_cast<float>(_sprite.getTextureRect().width) / 2,
-                      static_cast<float>(_sprite.getTextureRect().height) / 2);
+    if (texture_changed) {
+        _sprite.setTexture(_texture_group.getTexture(_current_texture_index), true);
+        _sprite.setOrigin(static_cast<float>(_sprite.getTextureRect().width) / 2,
+                          static_cast<float>(_sprite.getTextureRect().height) / 2);
+    }
+
+    // scale depends on the texture size and the mirror
+    updateSprite();
 }
 
 sf::Sprite EntitySpriteView::getSprite() const {
     return _sprite;
 }
 
+bool EntitySpriteView::isScreenSpace() const {
+    return _screen_space;
+}
+
+void EntitySpriteView::draw(sf::RenderTarget &target, const sf::RenderStates &states) const {
+    target.draw(_sprite, states);
+}
+
 void EntitySpriteView::updateSprite() {
     std::shared_ptr<Entity> entity_shared = _entity.lock();
     if (entity_shared) {
-        // transform
-        Vector2f new_position = entity_shared->getScreenPosition();
-        _sprite.setPosition(new_position.x, new_position.y);
+        updateBounds();
 
         auto texture_size = _sprite.getTexture()->getSize();
         Vector2f entity_size = entity_shared->getScale();
 
-        float x_scale_factor = entity_shared->getScreenViewSize().x /
+        if (_screen_space) {
+            // transform
+            Vector2f new_position = entity_shared->getScreenPosition();
+            _sprite.setPosition(new_position.x, new_position.y);
+
+            float x_scale_factor = entity_shared->getScreenViewSize().x /
+                                   static_cast<float>(texture_size.x) *
+                                   entity_size.x;
+
+            float y_scale_factor = entity_shared->getScreenViewSize().y /
+                                   static_cast<float>(texture_size.y) *
+                                   entity_size.y;
+
+            _sprite.setScale(_h_mirror ? -x_scale_factor : x_scale_factor, y_scale_factor);
+
+            _sprite.setRotation(to_degree(entity_shared->getRotation()));
+            return;
+        }
+
+        // transform in core coordinates, the camera transform flips the axes of the projection so the sprite is
+        // flipped in advance to end up upright on the screen
+        Vector2f new_position = entity_shared->getPosition();
+        _sprite.setPosition(new_position.x, new_position.y);
+
+        Vector2f projection_scale = entity_shared->getCamera()->getProjectionScale();
+        float x_sign = projection_scale.x < 0 ? -1.f : 1.f;
+        float y_sign = projection_scale.y < 0 ? -1.f : 1.f;
+
+        float x_scale_factor = entity_shared->getViewSize().x /
                                static_cast<float>(texture_size.x) *
-                               entity_size.x;
+                               entity_size.x * x_sign;
 
-        float y_scale_factor = entity_shared->getScreenViewSize().y /
+        float y_scale_factor = entity_shared->getViewSize().y /
                                static_cast<float>(texture_size.y) *
-                               entity_size.y;
+                               entity_size.y * y_sign;
 
         _sprite.setScale(_h_mirror ? -x_scale_factor : x_scale_factor, y_scale_factor);
 
-        _sprite.setRotation(to_degree(entity_shared->getRotation()));
+        // a mirrored projection turns the rotation around
+        _sprite.setRotation(to_degree(entity_shared->getRotation()) * x_sign * y_sign);
     }
 }
@@ -3,6 +3,7 @@
 
 
 #include "EntityView.h"
+#include "game/textures/TextureManager.h"
 #include <memory>
 #include <utility>
 
@@ -10,12 +11,14 @@ class EntitySpriteView : public EntityView {
 private:
     sf::Sprite _sprite;
     bool _h_mirror;
+    // screen space sprites are already projected, world space sprites get the camera transform while rendering
+    bool _screen_space;
 
-    std::shared_ptr<std::vector<sf::Texture>> _texture_group;
+    TextureHandle _texture_group;
     unsigned int _current_texture_index;
 
 public:
-    EntitySpriteView(std::weak_ptr<Entity> entity, std::shared_ptr<std::vector<sf::Texture>> texture_group);
+    EntitySpriteView(std::weak_ptr<Entity> entity, TextureHandle texture_group);
 
     void handleEvent() override;
 
@@ -25,6 +28,10 @@ public:
 
     sf::Sprite getSprite() const;
 
+    bool isScreenSpace() const override;
+
+    void draw(sf::RenderTarget &target, const sf::RenderStates &states) const override;
+
     void updateSprite();
 };
 
@@ -52,11 +52,21 @@ sf::Text EntityTextBoxView::getText() const {
     return _text_render;
 }
 
+bool EntityTextBoxView::isScreenSpace() const {
+    return true;
+}
+
+void EntityTextBoxView::draw(sf::RenderTarget &target, const sf::RenderStates &states) const {
+    target.draw(_text_render, states);
+}
+
 void EntityTextBoxView::updateText() {
     _text_render.setString(*_text);
 
     std::shared_ptr<Entity> entity_shared = _entity.lock();
     if (entity_shared) {
+        updateBounds();
+
         // transform
         Vector2f new_position = entity_shared->getScreenPosition();
         _text_render.setPosition(new_position.x, new_position.y);
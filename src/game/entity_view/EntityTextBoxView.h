@@ -25,6 +25,11 @@ public:
 
     sf::Text getText() const;
 
+    // text is projected to the screen by the view itself
+    bool isScreenSpace() const override;
+
+    void draw(sf::RenderTarget &target, const sf::RenderStates &states) const override;
+
     void updateText();
 
     void updateTextWrap(const Vector2f &view_size);
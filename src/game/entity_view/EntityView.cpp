@@ -1,9 +1,38 @@
 #include "EntityView.h"
+#include <cmath>
 
 EntityView::EntityView(std::weak_ptr<Entity> entity) : _entity(std::move(entity)) {
 
 }
 
+void EntityView::updateBounds() {
+    std::shared_ptr<Entity> shared_entity = _entity.lock();
+    if (!shared_entity) return;
+
+    Vector2f view_size = shared_entity->getViewSize();
+    Vector2f scale = shared_entity->getScale();
+    Vector2f half_size = {std::abs(view_size.x * scale.x) / 2, std::abs(view_size.y * scale.y) / 2};
+
+    // a rotated view fits in the circle around its corners
+    if (shared_entity->getRotation() != 0) {
+        float radius = half_size.length();
+        half_size = {radius, radius};
+    }
+
+    Vector2f position = shared_entity->getPosition();
+    _bounds_min = position - half_size;
+    _bounds_max = position + half_size;
+}
+
+bool EntityView::isInBounds(const Vector2f &x_bounds, const Vector2f &y_bounds) const {
+    return _bounds_max.x >= x_bounds.x && _bounds_min.x <= x_bounds.y &&
+           _bounds_max.y >= y_bounds.x && _bounds_min.y <= y_bounds.y;
+}
+
+bool EntityView::isScreenSpace() const {
+    return false;
+}
+
 sf::VertexArray EntityView::getHitbox() const {
     sf::VertexArray hitbox_draw = sf::VertexArray(sf::LineStrip, 5);
 
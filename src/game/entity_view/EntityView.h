@@ -11,16 +11,30 @@
 #include "core/math/math_funcs.h"
 #include <filesystem>
 #include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
 
 class EntityView : public IObserver {
 protected:
     std::weak_ptr<Entity> _entity;
 
+    // axis aligned bounds in core coordinates, cached when the view is updated
+    Vector2f _bounds_min;
+    Vector2f _bounds_max;
+
+    void updateBounds();
+
 public:
     explicit EntityView(std::weak_ptr<Entity> entity);
 
     ~EntityView() = default;
 
+    bool isInBounds(const Vector2f &x_bounds, const Vector2f &y_bounds) const;
+
+    // screen space views are drawn without the camera transform
+    virtual bool isScreenSpace() const;
+
+    virtual void draw(sf::RenderTarget &target, const sf::RenderStates &states) const = 0;
+
     virtual sf::VertexArray getHitbox() const;
 
     virtual sf::VertexArray getRays() const;
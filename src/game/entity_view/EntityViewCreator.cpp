@@ -1,36 +1,27 @@
 #include "EntityViewCreator.h"
 
-void EntityViewCreator::loadTextureGroup(const std::string &texture_group_name,
-                                         const std::vector<std::string> &texture_filenames) {
-    std::shared_ptr<std::vector<sf::Texture>> texture_group = std::make_shared<std::vector<sf::Texture>>();
-
-    for (const auto &texture_filename: texture_filenames) {
-        sf::Texture new_texture;
-
-        if (!new_texture.loadFromFile(texture_filename)) {
-            std::cerr << "Couldn't load the texture \"" + texture_filename + "\"" << std::endl;
-        }
+EntityViewCreator::EntityViewCreator()
+        : _texture_manager(constants::texture_budget), _particle_layer(0), _particle_draw_index(0) {
 
-        texture_group->push_back(new_texture);
-    }
+}
 
-    _texture_groups[texture_group_name] = texture_group;
+void EntityViewCreator::loadTextureGroup(TextureGroup texture_group,
+                                         const std::vector<std::string> &texture_filenames) {
+    // loaded on first use by a view
+    _texture_manager.registerGroup(texture_group, texture_filenames);
 }
 
-void EntityViewCreator::createEntitySpriteView(std::shared_ptr<Entity> entity, unsigned int layer) {
-    // todo: assert / exception if no texturegroupname than the entity has not corresponding texture files
+std::shared_ptr<IObserver> EntityViewCreator::createEntitySpriteView(std::shared_ptr<Entity> entity,
+                                                                     unsigned int layer) {
+    // todo: assert / exception if the entity has no texture group
 
     std::shared_ptr<EntitySpriteView> new_entity_sprite_view(
-            new EntitySpriteView(entity, _texture_groups[entity->getTextureGroupName()]));
-    std::weak_ptr<EntitySpriteView> new_entity_sprite_view_weak = new_entity_sprite_view;
-
-    if (_entity_sprite_views.count(layer)) {
-        _entity_sprite_views.at(layer).push_back(new_entity_sprite_view_weak);
-    } else {
-        _entity_sprite_views[layer] = {new_entity_sprite_view_weak};
-    }
+            new EntitySpriteView(entity, _texture_manager.acquire(entity->getTextureGroup())));
+    addEntityView(new_entity_sprite_view, layer);
 
     entity->addObserver(new_entity_sprite_view);
+
+    return new_entity_sprite_view;
 }
 
 void EntityViewCreator::createEntityTextView(std::shared_ptr<TextBox> entity_text_box) {
@@ -42,27 +33,73 @@ void EntityViewCreator::createEntityTextView(std::shared_ptr<TextBox> entity_tex
     entity_text_box->addObserver(new_entity_text_view);
 }
 
-std::vector<std::shared_ptr<EntitySpriteView>> EntityViewCreator::getEntitySpriteViews() {
-    std::map<unsigned int, std::vector<std::weak_ptr<EntitySpriteView>>> new_entity_sprite_views;
-    std::vector<std::shared_ptr<EntitySpriteView>> render_entity_sprite_views;
+void EntityViewCreator::createEntityHPBarView(std::shared_ptr<HPBar> hp_bar, unsigned int layer) {
+    std::shared_ptr<HPBarView> new_hp_bar_view(new HPBarView(hp_bar, getTextureGroupAtlas(hp_bar->getTextureGroup())));
+    addEntityView(new_hp_bar_view, layer);
 
-    for (const auto &[layer, layer_entity_views]: _entity_sprite_views) {
-        std::vector<std::weak_ptr<EntitySpriteView>> new_layer_entity_views;
+    hp_bar->addObserver(new_hp_bar_view);
+}
+
+void EntityViewCreator::loadParticleEffect(ParticleEffect effect, const std::vector<std::string> &texture_filenames) {
+    _particle_renderer.loadEffect(effect, texture_filenames);
+}
+
+void EntityViewCreator::createParticleSystemView(std::shared_ptr<const ParticleSystem> particle_system,
+                                                 unsigned int layer) {
+    _particle_renderer.setParticleSystem(std::move(particle_system));
+    _particle_layer = layer;
+}
+
+void EntityViewCreator::takeCensus(Census &census) {
+    census.registerType<EntitySpriteView>("EntitySpriteView");
+    census.registerType<HPBarView>("HPBarView");
+    census.registerType<EntityTextBoxView>("EntityTextBoxView");
+
+    for (const auto &[layer, layer_entity_views]: _entity_views) {
+        for (const auto &entity_view: layer_entity_views) {
+            if (std::shared_ptr<EntityView> entity_view_shared = entity_view.lock()) {
+                census.add(*entity_view_shared, Census::shared_control_block_bytes);
+            }
+        }
+    }
+
+    for (const auto &entity_text_view: _entity_text_views) {
+        if (std::shared_ptr<EntityTextBoxView> entity_text_view_shared = entity_text_view.lock()) {
+            census.add(*entity_text_view_shared, Census::shared_control_block_bytes);
+        }
+    }
+
+    // gpu memory of the resident texture groups
+    unsigned int resident_groups = 0;
+    for (std::size_t i = 0; i < idCount<TextureGroup>(); i++) {
+        if (_texture_manager.getGroupBytes(static_cast<TextureGroup>(i)) > 0) resident_groups++;
+    }
+    census.add("textures", resident_groups, _texture_manager.getResidentBytes());
+}
+
+std::vector<std::shared_ptr<EntityView>> EntityViewCreator::getEntityViews() {
+    std::map<unsigned int, std::vector<std::weak_ptr<EntityView>>> new_entity_views;
+    std::vector<std::shared_ptr<EntityView>> render_entity_views;
+    _particle_draw_index = 0;
+
+    for (const auto &[layer, layer_entity_views]: _entity_views) {
+        std::vector<std::weak_ptr<EntityView>> new_layer_entity_views;
 
         for (const auto &entity_view: layer_entity_views) {
             if (!entity_view.expired()) {
                 new_layer_entity_views.push_back(entity_view);
 
-                render_entity_sprite_views.push_back(entity_view.lock());
+                render_entity_views.push_back(entity_view.lock());
             }
         }
 
-        new_entity_sprite_views[layer] = new_layer_entity_views;
+        new_entity_views[layer] = new_layer_entity_views;
+        if (layer < _particle_layer) _particle_draw_index = render_entity_views.size();
     }
 
-    _entity_sprite_views = new_entity_sprite_views;
+    _entity_views = new_entity_views;
 
-    return render_entity_sprite_views;
+    return render_entity_views;
 }
 
 std::vector<std::shared_ptr<EntityTextBoxView>> EntityViewCreator::getEntityTextViews() {
@@ -81,3 +118,36 @@ std::vector<std::shared_ptr<EntityTextBoxView>> EntityViewCreator::getEntityText
 
     return render_entity_text_views;
 }
+
+ParticleRenderer &EntityViewCreator::getParticleRenderer() {
+    return _particle_renderer;
+}
+
+std::size_t EntityViewCreator::getParticleDrawIndex() const {
+    return _particle_draw_index;
+}
+
+void EntityViewCreator::addEntityView(const std::shared_ptr<EntityView> &entity_view, unsigned int layer) {
+    _entity_views[layer].push_back(entity_view);
+}
+
+std::shared_ptr<TextureAtlas> EntityViewCreator::getTextureGroupAtlas(TextureGroup texture_group) {
+    if (texture_group == TextureGroup::none) return std::make_shared<TextureAtlas>();
+
+    std::shared_ptr<TextureAtlas> &atlas = _texture_group_atlases[toIndex(texture_group)];
+    if (!atlas) {
+        atlas = std::make_shared<TextureAtlas>();
+
+        // the atlas keeps its own copy, the group may be evicted afterwards
+        TextureHandle texture_handle = _texture_manager.acquire(texture_group);
+        for (unsigned int i = 0; i < texture_handle.getTextureCount(); i++) {
+            atlas->addImage(texture_handle.getTexture(i).copyToImage());
+        }
+    }
+
+    return atlas;
+}
+
+TextureManager &EntityViewCreator::getTextureManager() {
+    return _texture_manager;
+}
@@ -2,29 +2,63 @@
 #define GAMEENGINE_ENTITYVIEWCREATOR_H
 
 #include <map>
+#include <array>
 #include "core/entities/IEntityViewCreator.h"
 #include "EntityView.h"
 #include "EntitySpriteView.h"
 #include "EntityTextBoxView.h"
+#include "HPBarView.h"
+#include "game/textures/TextureManager.h"
+#include "game/effects/ParticleRenderer.h"
+#include "game/constants.h"
 
 class EntityViewCreator : public IEntityViewCreator {
 private:
-    std::map<std::string, std::shared_ptr<std::vector<sf::Texture>>> _texture_groups;
+    TextureManager _texture_manager;
+    // built on first use, the region index matches the texture index in the group
+    std::array<std::shared_ptr<TextureAtlas>, idCount<TextureGroup>()> _texture_group_atlases;
 
-    std::map<unsigned int, std::vector<std::weak_ptr<EntitySpriteView>>> _entity_sprite_views;
+    // sprite and hp bar views by render layer
+    std::map<unsigned int, std::vector<std::weak_ptr<EntityView>>> _entity_views;
     std::vector<std::weak_ptr<EntityTextBoxView>> _entity_text_views;
 
+    ParticleRenderer _particle_renderer;
+    unsigned int _particle_layer;
+    // amount of layered views drawn before the particles
+    std::size_t _particle_draw_index;
+
 public:
-    void loadTextureGroup(const std::string &texture_group_name,
-                          const std::vector<std::string> &texture_filenames) override;
+    EntityViewCreator();
+
+    void loadTextureGroup(TextureGroup texture_group, const std::vector<std::string> &texture_filenames) override;
 
-    void createEntitySpriteView(std::shared_ptr<Entity> entity, unsigned int layer) override;
+    std::shared_ptr<IObserver> createEntitySpriteView(std::shared_ptr<Entity> entity, unsigned int layer) override;
 
     void createEntityTextView(std::shared_ptr<TextBox> entity_text_box) override;
 
-    std::vector<std::shared_ptr<EntitySpriteView>> getEntitySpriteViews();
+    void createEntityHPBarView(std::shared_ptr<HPBar> hp_bar, unsigned int layer) override;
+
+    void loadParticleEffect(ParticleEffect effect, const std::vector<std::string> &texture_filenames) override;
+
+    void createParticleSystemView(std::shared_ptr<const ParticleSystem> particle_system, unsigned int layer) override;
+
+    void takeCensus(Census &census) override;
+
+    std::vector<std::shared_ptr<EntityView>> getEntityViews();
 
     std::vector<std::shared_ptr<EntityTextBoxView>> getEntityTextViews();
+
+    ParticleRenderer &getParticleRenderer();
+
+    TextureManager &getTextureManager();
+
+    // index into the last getEntityViews result
+    std::size_t getParticleDrawIndex() const;
+
+private:
+    void addEntityView(const std::shared_ptr<EntityView> &entity_view, unsigned int layer);
+
+    std::shared_ptr<TextureAtlas> getTextureGroupAtlas(TextureGroup texture_group);
 };
 
 
@@ -0,0 +1,56 @@
+#include "HPBarView.h"
+
+HPBarView::HPBarView(const std::weak_ptr<HPBar> &hp_bar, std::shared_ptr<TextureAtlas> heart_atlas)
+        : EntityView(hp_bar), _hp_bar(hp_bar), _heart_atlas(std::move(heart_atlas)), _vertices(sf::Quads) {
+    updateHearts();
+}
+
+void HPBarView::handleEvent() {
+    updateHearts();
+}
+
+void HPBarView::handleEvent(const unsigned int &event, const unsigned int &channel) {
+
+}
+
+void HPBarView::draw(sf::RenderTarget &target, const sf::RenderStates &states) const {
+    if (_vertices.getVertexCount() == 0) return;
+
+    sf::RenderStates hp_bar_states = states;
+    hp_bar_states.texture = &_heart_atlas->getTexture();
+    target.draw(_vertices, hp_bar_states);
+}
+
+void HPBarView::updateHearts() {
+    std::shared_ptr<HPBar> hp_bar = _hp_bar.lock();
+    if (!hp_bar) return;
+
+    updateBounds();
+
+    Vector2f half_size = hp_bar->getHeartSize() / 2;
+    _vertices.resize(hp_bar->getMaxHitPoints() * 4);
+
+    for (unsigned int i = 0; i < hp_bar->getMaxHitPoints(); i++) {
+        bool full = i < hp_bar->getCurrentHitPoints();
+        const sf::IntRect &region = _heart_atlas->getRegion(
+                full ? hp_bar->getFullTextureIndex() : hp_bar->getEmptyTextureIndex());
+
+        float left = static_cast<float>(region.left);
+        float top = static_cast<float>(region.top);
+        float right = left + static_cast<float>(region.width);
+        float bottom = top + static_cast<float>(region.height);
+
+        // core coordinates, the top of the texture goes to the highest y
+        Vector2f position = hp_bar->getHeartPosition(i);
+        sf::Vertex *quad = &_vertices[i * 4];
+        quad[0].position = {position.x - half_size.x, position.y + half_size.y};
+        quad[1].position = {position.x + half_size.x, position.y + half_size.y};
+        quad[2].position = {position.x + half_size.x, position.y - half_size.y};
+        quad[3].position = {position.x - half_size.x, position.y - half_size.y};
+
+        quad[0].texCoords = {left, top};
+        quad[1].texCoords = {right, top};
+        quad[2].texCoords = {right, bottom};
+        quad[3].texCoords = {left, bottom};
+    }
+}
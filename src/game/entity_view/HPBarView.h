@@ -0,0 +1,30 @@
+#ifndef GAMEENGINE_HPBARVIEW_H
+#define GAMEENGINE_HPBARVIEW_H
+
+
+#include "EntityView.h"
+#include "core/entities/ui/hp-bar/HPBar.h"
+#include "game/effects/TextureAtlas.h"
+
+// every heart of a bar is a quad of one vertex array, the heart textures share an atlas
+class HPBarView : public EntityView {
+private:
+    std::weak_ptr<HPBar> _hp_bar;
+    std::shared_ptr<TextureAtlas> _heart_atlas;
+
+    sf::VertexArray _vertices;
+
+public:
+    HPBarView(const std::weak_ptr<HPBar> &hp_bar, std::shared_ptr<TextureAtlas> heart_atlas);
+
+    void handleEvent() override;
+
+    void handleEvent(const unsigned int &event, const unsigned int &channel) override;
+
+    void draw(sf::RenderTarget &target, const sf::RenderStates &states) const override;
+
+    void updateHearts();
+};
+
+
+#endif //GAMEENGINE_HPBARVIEW_H
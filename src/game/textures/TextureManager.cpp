@@ -0,0 +1,150 @@
+#include "TextureManager.h"
+
+#include <iostream>
+
+TextureHandle::TextureHandle(std::shared_ptr<TextureGroupData> group) : _group(std::move(group)) {
+    if (_group) _group->references++;
+}
+
+TextureHandle::~TextureHandle() {
+    release();
+}
+
+TextureHandle::TextureHandle(TextureHandle &&other) noexcept: _group(std::move(other._group)) {
+
+}
+
+TextureHandle &TextureHandle::operator=(TextureHandle &&other) noexcept {
+    if (this != &other) {
+        release();
+        _group = std::move(other._group);
+    }
+
+    return *this;
+}
+
+bool TextureHandle::isValid() const {
+    return _group != nullptr;
+}
+
+const sf::Texture &TextureHandle::getTexture(unsigned int texture_index) const {
+    return _group->textures.at(texture_index);
+}
+
+std::size_t TextureHandle::getTextureCount() const {
+    return _group ? _group->textures.size() : 0;
+}
+
+void TextureHandle::release() {
+    if (_group) {
+        _group->references--;
+        _group = nullptr;
+    }
+}
+
+TextureManager::TextureManager(std::size_t budget)
+        : _budget(budget), _resident_bytes(0), _acquire_counter(0), _evictions(0) {
+
+}
+
+void TextureManager::registerGroup(TextureGroup texture_group, const std::vector<std::string> &texture_filenames) {
+    std::shared_ptr<TextureGroupData> &group = _groups[toIndex(texture_group)];
+    if (group) {
+        // reloading a group with live handles would invalidate the textures they point to
+        if (group->references > 0) {
+            std::cerr << "Texture group is in use and can't be replaced" << std::endl;
+            return;
+        }
+        evict(*group);
+    }
+
+    group = std::make_shared<TextureGroupData>();
+    group->filenames = texture_filenames;
+}
+
+TextureHandle TextureManager::acquire(TextureGroup texture_group) {
+    if (texture_group == TextureGroup::none || !_groups[toIndex(texture_group)]) return {};
+
+    const std::shared_ptr<TextureGroupData> &group = _groups[toIndex(texture_group)];
+    group->last_acquired = ++_acquire_counter;
+
+    if (group->textures.empty() && !group->filenames.empty()) {
+        load(*group);
+    }
+
+    // the handle protects the group from the eviction
+    TextureHandle texture_handle(group);
+    enforceBudget();
+
+    return texture_handle;
+}
+
+void TextureManager::setBudget(std::size_t budget) {
+    _budget = budget;
+    enforceBudget();
+}
+
+std::size_t TextureManager::getBudget() const {
+    return _budget;
+}
+
+std::size_t TextureManager::getResidentBytes() const {
+    return _resident_bytes;
+}
+
+std::size_t TextureManager::getGroupBytes(TextureGroup texture_group) const {
+    if (texture_group == TextureGroup::none || !_groups[toIndex(texture_group)]) return 0;
+
+    return _groups[toIndex(texture_group)]->bytes;
+}
+
+unsigned int TextureManager::getEvictions() const {
+    return _evictions;
+}
+
+void TextureManager::load(TextureGroupData &group) {
+    // constructed in place, the vector never grows so textures are never copied
+    group.textures.reserve(group.filenames.size());
+
+    for (const auto &texture_filename: group.filenames) {
+        sf::Texture &texture = group.textures.emplace_back();
+
+        if (!texture.loadFromFile(texture_filename)) {
+            std::cerr << "Couldn't load the texture \"" + texture_filename + "\"" << std::endl;
+        }
+
+        // rgba8, no mipmaps
+        group.bytes += static_cast<std::size_t>(texture.getSize().x) * texture.getSize().y * 4;
+    }
+
+    _resident_bytes += group.bytes;
+}
+
+void TextureManager::evict(TextureGroupData &group) {
+    if (group.textures.empty()) return;
+
+    _resident_bytes -= group.bytes;
+    group.bytes = 0;
+
+    // frees the gpu memory
+    std::vector<sf::Texture>().swap(group.textures);
+    _evictions++;
+}
+
+void TextureManager::enforceBudget() {
+    while (_resident_bytes > _budget) {
+        TextureGroupData *oldest_group = nullptr;
+
+        for (const auto &group: _groups) {
+            if (!group || group->textures.empty() || group->references > 0) continue;
+
+            if (!oldest_group || group->last_acquired < oldest_group->last_acquired) {
+                oldest_group = group.get();
+            }
+        }
+
+        if (!oldest_group) return;
+
+        evict(*oldest_group);
+    }
+}
@@ -0,0 +1,91 @@
+#ifndef GAMEENGINE_TEXTUREMANAGER_H
+#define GAMEENGINE_TEXTUREMANAGER_H
+
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+#include <SFML/Graphics/Texture.hpp>
+#include "core/constants/resource_ids.h"
+
+// textures of a group, shared between the manager and the handles so a handle never dangles
+struct TextureGroupData {
+    std::vector<std::string> filenames;
+    std::vector<sf::Texture> textures;
+    std::size_t bytes = 0;
+    // live handles, groups with handles are never evicted
+    unsigned int references = 0;
+    unsigned long long last_acquired = 0;
+};
+
+// move-only reference to a resident texture group
+class TextureHandle {
+private:
+    std::shared_ptr<TextureGroupData> _group;
+
+public:
+    TextureHandle() = default;
+
+    explicit TextureHandle(std::shared_ptr<TextureGroupData> group);
+
+    ~TextureHandle();
+
+    TextureHandle(const TextureHandle &) = delete;
+
+    TextureHandle &operator=(const TextureHandle &) = delete;
+
+    TextureHandle(TextureHandle &&other) noexcept;
+
+    TextureHandle &operator=(TextureHandle &&other) noexcept;
+
+    bool isValid() const;
+
+    const sf::Texture &getTexture(unsigned int texture_index) const;
+
+    std::size_t getTextureCount() const;
+
+private:
+    void release();
+};
+
+// loads texture groups on first use and keeps the gpu memory of the resident groups under a budget, groups without
+// live handles are evicted least recently acquired first
+class TextureManager {
+private:
+    std::array<std::shared_ptr<TextureGroupData>, idCount<TextureGroup>()> _groups;
+
+    std::size_t _budget;
+    std::size_t _resident_bytes;
+    unsigned long long _acquire_counter;
+    unsigned int _evictions;
+
+public:
+    explicit TextureManager(std::size_t budget);
+
+    // only stores the filenames, the textures are loaded by the first acquire
+    void registerGroup(TextureGroup texture_group, const std::vector<std::string> &texture_filenames);
+
+    TextureHandle acquire(TextureGroup texture_group);
+
+    void setBudget(std::size_t budget);
+
+    std::size_t getBudget() const;
+
+    std::size_t getResidentBytes() const;
+
+    std::size_t getGroupBytes(TextureGroup texture_group) const;
+
+    unsigned int getEvictions() const;
+
+private:
+    void load(TextureGroupData &group);
+
+    void evict(TextureGroupData &group);
+
+    // evicts unreferenced groups until the resident groups fit in the budget or nothing can be evicted
+    void enforceBudget();
+};
+
+
+#endif //GAMEENGINE_TEXTUREMANAGER_H